@@ -0,0 +1,3773 @@
+/** @file       core.c
+ *  @brief      RCoS+ main functions
+ *  @copyright  (c) 2018-Arcelik - All Rights Reserved
+ *              Permission to use, reproduce, copy, prepare derivative works,
+ *              modify, distribute, perform, display or sell this software and/or
+ *              its documentation for any purpose is prohibited without the express
+ *              written consent of Arcelik A.S.
+ *  @date       17.10.2026
+ */
+#define FILE_CORE_C
+
+#include "rcos.h"
+#include "libs/json.h"
+#include <stdarg.h>
+#include <string.h>
+
+/// @brief  Reset code for an event queue overflow
+#define CORE_RESET_EVENT_OVERFLOW (0x237)
+/// @brief  Reset code for a timer callback started without a function
+#define CORE_RESET_CALLBACK_NULL (97)
+/// @brief  Flag for eventPostRaw only, post is already recorded in trace and it is not stored with the event
+#define EVENT_FLAG_TRACED (0x80u)
+/// @brief  Returned by eventPostRaw when post is dropped on purpose, posting it again would not deliver it either
+#define EVENT_POST_DROPPED (2)
+/// @brief  Result of eventPostRaw as it is returned to applications
+#define EVENT_POST_RESULT(_result) ((EXIT_SUCCESS == (_result)) ? EXIT_SUCCESS : EXIT_FAILURE)
+/// @brief  Flag of isr ingress ring slots only, event is posted by core itself and it is not an external input
+#define ISR_SLOT_CORE (0x80u)
+/// @brief  Size of an input record heading in storage
+#define RECORD_HEADING_SIZE (8u)
+/// @brief  Device index returned for devices that are not registered to recorder
+#define RECORD_DEVICE_NONE (0xFFu)
+/// @brief  Ring index of a signal position
+#define SIGNAL_INDEX(_position) ((_position) & (CORE_EVENTQUEUE_SIGNALS - 1u))
+/// @brief  Pack an event without data into a signal word
+#define SIGNAL_PACK(_post) ((uint32_t)(_post)->destination | ((uint32_t)(_post)->source << 8) | ((uint32_t)(_post)->event << 16) | ((uint32_t)(_post)->flags << 24))
+
+/*********************************************************************
+ *  LOCAL VARIABLES
+ */
+extern tsEventQueue eventQueue; ///< Shared queue created in main.c with CORE_EVENTQUEUE_SIZE macro
+
+/// @brief  Number of slots on the first level of a timer wheel
+#define TIMER_WHEEL_L0_SIZE (1ul << CORE_TIMER_WHEEL_L0_BITS)
+/// @brief  Number of slots on upper levels of a timer wheel
+#define TIMER_WHEEL_LN_SIZE (1ul << CORE_TIMER_WHEEL_LN_BITS)
+/// @brief  Number of levels needed to cover 32-bit tick range
+#define TIMER_WHEEL_LEVELS (1 + (32 - CORE_TIMER_WHEEL_L0_BITS + CORE_TIMER_WHEEL_LN_BITS - 1) / CORE_TIMER_WHEEL_LN_BITS)
+/// @brief  Total number of slots in a timer wheel
+#define TIMER_WHEEL_SLOTS (TIMER_WHEEL_L0_SIZE + (TIMER_WHEEL_LEVELS - 1) * TIMER_WHEEL_LN_SIZE)
+
+/** @brief      Hierarchical timing wheel
+ *  @details    Each slot is the sentinel of a circular list so that a timer can be unlinked without knowing its slot.
+ *              An empty slot has NULL pointers until the first insertion.
+ *              Timers are placed by their expiry tick(kept in _cnt), first level holds timers expiring in the next
+ *              TIMER_WHEEL_L0_SIZE ticks and upper levels are cascaded down each time the lower level wraps.
+ */
+typedef struct
+{
+    tsLdlItem slot[TIMER_WHEEL_SLOTS]; ///< Slots of all levels, first level is at the beginning
+    uint32_t count;                    ///< Number of armed timers
+} tsTimerWheel;
+
+/// @brief  Common heading of all timer objects
+typedef struct
+{
+    tsLdlItem _li;
+    uint32_t _cnt;
+} tsTimerHeading;
+
+static tsLdl processList = LIST_DL_INIT();
+
+#if (CORE_ISR_RING_SIZE & (CORE_ISR_RING_SIZE - 1))
+#error CORE_ISR_RING_SIZE must be a power of 2
+#endif
+
+/** @brief      Slot of isr ingress ring
+ *  @details    Ring is a bounded multi-producer single-consumer queue. Each slot carries a sequence number, it equals
+ *              the ring position when the slot is free for that position and position + 1 when it holds an event.
+ */
+typedef struct
+{
+    uint32_t sequence;                  ///< Accessed atomically
+    uint32_t time;                      ///< Trace time of post
+    tsEventPost post;                   ///< Event information
+    uint8_t data[CORE_ISR_EVENT_DATA];  ///< Data of event
+} tsIsrSlot;
+
+static tsIsrSlot isrRing[CORE_ISR_RING_SIZE];
+static uint32_t isrRingHead; ///< Next position to be claimed by producers, accessed atomically
+static uint32_t isrRingTail; ///< Next position to be taken by coreRun
+
+static tsEventReady eventReady;                      ///< Ready lists of group 0, other groups have them in rcosExecutor
+static PLATFORM_THREAD_LOCAL uint8_t executorGroup; ///< Executor group dispatched by calling thread
+
+static tsTimerWheel timerGenericWheel;
+static tsTimerWheel timerCallBackWheel;
+static tsTimerWheel timerEventWheel;
+static tsLdl timerDeferred; ///< Expired deferred callbacks waiting for coreRun
+static tsLdl hrTimerQueue;    ///< Running high resolution timers sorted by deadline
+static tsLdl hrTimerDeferred; ///< Expired deferred high resolution callbacks waiting for coreRun
+
+static volatile uint32_t timerTickCount; ///< Number of ticks since coreRun
+static tsProcess *volatile dispatchProcess; ///< Process of running handler call or protothread step, NULL between them
+static volatile uint32_t dispatchStart;     ///< Tick that running call started
+static volatile uint8_t dispatchWarned;     ///< Deadline warning of running call is given
+
+static tProcessEnum processHiddenMin = PROCESS_NONE; ///< Enumerations given to processes created with PROCESS_NONE
+
+/// @brief  Information of last software reset
+static struct
+{
+    uint32_t code;
+    uint32_t info;
+} coreSysResetInfo;
+
+/*********************************************************************
+ *  INTERFACES: VARIABLES
+ */
+tsLsl rcosVersionList = LIST_SL_INIT();
+tsLsl userVersionList = LIST_SL_INIT();
+
+/*********************************************************************
+ *  LOCAL FUNCTIONS
+ */
+
+/// @brief  Record reset reason and wait for watchdog to reset the system
+static void coreSysReset(uint32_t code, uint32_t info)
+{
+    globalIntDisable();
+    rcosWdt.start();
+    rcosWdt.refresh();
+    coreSysResetInfo.code = code;
+    coreSysResetInfo.info = info;
+    for (;;)
+    {
+    }
+}
+
+/// @brief  Find the slot that a timer expiring on target tick should be placed
+static tsLdlItem *timerWheelSlot(tsTimerWheel *wheel, uint32_t expires)
+{
+    uint32_t delta = expires - timerTickCount;
+    uint32_t base  = TIMER_WHEEL_L0_SIZE;
+    uint8_t shift  = CORE_TIMER_WHEEL_L0_BITS;
+    uint8_t level;
+
+    if (delta < TIMER_WHEEL_L0_SIZE)
+    {
+        return &wheel->slot[expires & (TIMER_WHEEL_L0_SIZE - 1)];
+    }
+
+    for (level = 1; level < (TIMER_WHEEL_LEVELS - 1); level++)
+    {
+        if (delta < (1ul << (shift + CORE_TIMER_WHEEL_LN_BITS)))
+        {
+            break;
+        }
+        shift += CORE_TIMER_WHEEL_LN_BITS;
+        base += TIMER_WHEEL_LN_SIZE;
+    }
+
+    return &wheel->slot[base + ((expires >> shift) & (TIMER_WHEEL_LN_SIZE - 1))];
+}
+
+/// @brief  Place a timer on the wheel with the expiry tick in its _cnt
+static void timerWheelInsert(tsTimerWheel *wheel, tsTimerHeading *timer)
+{
+    tsLdlItem *slot = timerWheelSlot(wheel, timer->_cnt);
+
+    if (NULL == slot->tail)
+    {
+        slot->head = slot;
+        slot->tail = slot;
+    }
+
+    timer->_li.head  = slot->head;
+    timer->_li.tail  = slot;
+    slot->head->tail = &timer->_li;
+    slot->head       = &timer->_li;
+    wheel->count++;
+}
+
+/// @brief  Remove a timer from the wheel if it is armed
+static void timerWheelRemove(tsTimerWheel *wheel, tsTimerHeading *timer)
+{
+    if (timer->_li.head)
+    {
+        timer->_li.head->tail = timer->_li.tail;
+        timer->_li.tail->head = timer->_li.head;
+        timer->_li.head       = NULL;
+        timer->_li.tail       = NULL;
+        wheel->count--;
+    }
+}
+
+/** @brief  Arm a timer to expire after period ticks, an armed timer is restarted
+ *  @param  slack   Expiry may be delayed up to slack ticks, it is moved to the tick with most trailing zero bits in
+ *                  the window so timers started at different times with similar periods expire together
+ */
+static void timerWheelStart(tsTimerWheel *wheel, tsTimerHeading *timer, uint32_t period, uint16_t slack)
+{
+    uint32_t expires = timerTickCount + MIN(MAX(period, 1ul), CORE_TIMER_PERIOD_MAX);
+    uint32_t limit   = expires + slack;
+    uint32_t mask;
+
+    if (limit > expires) // Slack is given and window does not wrap
+    {
+        mask = expires ^ limit;
+        mask |= mask >> 1;
+        mask |= mask >> 2;
+        mask |= mask >> 4;
+        mask |= mask >> 8;
+        mask |= mask >> 16;
+        expires = limit & ~(mask >> 1); // Clear bits below highest one that differs in window
+    }
+
+    timerWheelRemove(wheel, timer);
+    timer->_cnt = expires;
+    timerWheelInsert(wheel, timer);
+}
+
+/// @brief  Take the next timer from a slot
+static tsTimerHeading *timerWheelPop(tsTimerWheel *wheel, tsLdlItem *slot)
+{
+    tsTimerHeading *timer;
+
+    if ((NULL == slot->tail) || (slot == slot->tail))
+    {
+        return NULL;
+    }
+
+    timer = (tsTimerHeading *)slot->tail;
+    timerWheelRemove(wheel, timer);
+
+    return timer;
+}
+
+/// @brief  Move timers on upper levels down if first level has wrapped, returns first level slot of current tick
+static tsLdlItem *timerWheelAdvance(tsTimerWheel *wheel)
+{
+    uint32_t idx   = timerTickCount & (TIMER_WHEEL_L0_SIZE - 1);
+    uint32_t base  = TIMER_WHEEL_L0_SIZE;
+    uint8_t shift  = CORE_TIMER_WHEEL_L0_BITS;
+    tsTimerHeading *timer;
+    uint32_t levelIdx;
+    uint8_t level;
+
+    if (0 == idx)
+    {
+        for (level = 1; level < TIMER_WHEEL_LEVELS; level++)
+        {
+            levelIdx = (timerTickCount >> shift) & (TIMER_WHEEL_LN_SIZE - 1);
+            while (NULL != (timer = timerWheelPop(wheel, &wheel->slot[base + levelIdx])))
+            {
+                timerWheelInsert(wheel, timer);
+            }
+            if (levelIdx)
+            {
+                break;
+            }
+            shift += CORE_TIMER_WHEEL_LN_BITS;
+            base += TIMER_WHEEL_LN_SIZE;
+        }
+    }
+
+    return &wheel->slot[idx];
+}
+
+/** @brief      Number of ticks until the first timer on the wheel expires
+ *  @details    Timers on upper levels are cascaded down when first level wraps, none of them can expire before that.
+ *              They are not sorted, so they are only checked if first level has nothing to expire until the wrap.
+ *  @return     Ticks until first expiry, CORE_TIMER_PERIOD_MAX if wheel is empty
+ */
+static uint32_t timerWheelNext(tsTimerWheel *wheel)
+{
+    uint32_t wrap = TIMER_WHEEL_L0_SIZE - (timerTickCount & (TIMER_WHEEL_L0_SIZE - 1));
+    uint32_t next = CORE_TIMER_PERIOD_MAX;
+    tsLdlItem *slot;
+    tsLdlItem *item;
+    uint32_t delta;
+
+    if (0 == wheel->count)
+    {
+        return next;
+    }
+
+    for (delta = 1; delta < TIMER_WHEEL_L0_SIZE; delta++)
+    {
+        slot = &wheel->slot[(timerTickCount + delta) & (TIMER_WHEEL_L0_SIZE - 1)];
+        if ((NULL != slot->tail) && (slot != slot->tail))
+        {
+            next = delta;
+            break;
+        }
+    }
+
+    if (next <= wrap)
+    {
+        return next;
+    }
+
+    for (slot = &wheel->slot[TIMER_WHEEL_L0_SIZE]; slot < &wheel->slot[TIMER_WHEEL_SLOTS]; slot++)
+    {
+        for (item = slot->tail; (NULL != item) && (slot != item); item = item->tail)
+        {
+            next = MIN(next, ((tsTimerHeading *)item)->_cnt - timerTickCount);
+        }
+    }
+
+    return next;
+}
+
+/// @brief  Number of ticks until the next timer expiry on any wheel or the next first level wrap
+static uint32_t timerTickNext(void)
+{
+    uint32_t next = TIMER_WHEEL_L0_SIZE - (timerTickCount & (TIMER_WHEEL_L0_SIZE - 1));
+
+    next = MIN(next, timerWheelNext(&timerGenericWheel));
+    next = MIN(next, timerWheelNext(&timerCallBackWheel));
+    next = MIN(next, timerWheelNext(&timerEventWheel));
+
+    return next;
+}
+
+/// @brief  Event buffer heading of data returned by eventBufAlloc
+#define EVENT_BUF_HEADING(_buf) ((tsEventBuf *)(_buf)-1)
+
+/** @brief  Place an eTraceLost record for records lost while ring was full
+ *  @details Interrupts must be disabled, rcosTrace must exist and ring must have space for the record.
+ *  @param  time    Cycle counter value of record
+ */
+static void traceLost(uint32_t time)
+{
+    tsTraceRecord *record = &rcosTrace->records[rcosTrace->head];
+
+    record->time        = time;
+    record->kind        = eTraceLost;
+    record->source      = (uint8_t)rcosTrace->lost;
+    record->destination = (uint8_t)(rcosTrace->lost >> 8);
+    record->event       = (uint8_t)MIN(rcosTrace->lost >> 16, 0xFFul);
+    rcosTrace->lost     = 0;
+    rcosTrace->head     = (uint16_t)((rcosTrace->head + 1) % rcosTrace->size);
+    rcosTrace->count++;
+}
+
+/** @brief  Put a record into trace ring, a pending eTraceLost record is placed first
+ *  @details Interrupts must be disabled and rcosTrace must exist.
+ *  @param  time        Cycle counter value of record
+ *  @param  kind        teTraceKind
+ *  @param  source      Source process
+ *  @param  destination Destination process
+ *  @param  event       Event
+ */
+static void traceRecordRaw(uint32_t time, teTraceKind kind, tProcessEnum source, tProcessEnum destination, tEventEnum event)
+{
+    tsTraceRecord *record;
+
+    if (!rcosTrace->active)
+    {
+        return;
+    }
+
+    if ((rcosTrace->count + (rcosTrace->lost ? 1 : 0)) >= rcosTrace->size)
+    {
+        rcosTrace->lost++;
+        return;
+    }
+
+    if (rcosTrace->lost)
+    {
+        traceLost(time);
+    }
+
+    record              = &rcosTrace->records[rcosTrace->head];
+    record->time        = time;
+    record->kind        = (uint8_t)kind;
+    record->source      = source;
+    record->destination = destination;
+    record->event       = event;
+    rcosTrace->head     = (uint16_t)((rcosTrace->head + 1) % rcosTrace->size);
+    rcosTrace->count++;
+}
+
+/** @brief  Put a record into trace ring from a context where interrupts are enabled, rcosTrace must exist
+ *  @param  time        Cycle counter value of record
+ *  @param  kind        teTraceKind
+ *  @param  source      Source process
+ *  @param  destination Destination process
+ *  @param  event       Event
+ */
+static void traceRecord(uint32_t time, teTraceKind kind, tProcessEnum source, tProcessEnum destination, tEventEnum event)
+{
+    globalIntDisable();
+    traceRecordRaw(time, kind, source, destination, event);
+    globalIntEnable();
+}
+
+/// @brief  Ready lists of an executor group
+static tsEventReady *groupReady(uint8_t group)
+{
+    return group ? &rcosExecutor->groups[group].ready : &eventReady;
+}
+
+/// @brief  Queue of an executor group for processes without own queue
+static tsEventQueue *groupQueue(uint8_t group)
+{
+    return group ? &rcosExecutor->groups[group].queue : &eventQueue;
+}
+
+/// @brief  Ready list of a queue, selected by priority of its process
+static tsLdl *eventReadyList(const tsEventQueue *queue)
+{
+    return &groupReady(queue->group)->list[MIN(queue->process ? queue->process->priority : CORE_PRIORITY_DEFAULT, CORE_PRIORITY_LEVELS - 1)];
+}
+
+/** @brief  Decrease number of waiting events of a process and end congestion at low watermark
+ *  @details Interrupts must be disabled.
+ *  @param  process Process pointer
+ */
+static void processUnload(tsProcess *process)
+{
+    if (process->evCntLoad)
+    {
+        process->evCntLoad--;
+    }
+
+    if (process->quota && (process->evCntLoad <= process->quota->low))
+    {
+        process->quota->congested = FALSE;
+    }
+}
+
+/** @brief  Check if an event fits a queue
+ *  @details Interrupts must be disabled.
+ *  @param  queue   Event queue
+ *  @param  length  Length of data of event
+ *  @return TRUE if there is room in signal ring or byte queue
+ */
+static teBool eventQueueRoom(const tsEventQueue *queue, uint8_t length)
+{
+#if CORE_EVENTQUEUE_SIGNALS
+    if ((0 == length) && ((uint8_t)(queue->signalHead - queue->signalTail) < CORE_EVENTQUEUE_SIGNALS))
+    {
+        return TRUE;
+    }
+#endif
+
+    return (DEQUE_FREE(&queue->queue) >= (uint32_t)length + sizeof(tsEventPost)) ? TRUE : FALSE;
+}
+
+/// @brief  Unlink a queue whose last event is taken from its ready list, interrupts must be disabled
+static void eventQueueDrained(tsEventQueue *queue)
+{
+    tsEventReady *lists = groupReady(queue->group);
+
+    ldlDelete(eventReadyList(queue), queue);
+    if (lists->burstQueue == queue)
+    {
+        lists->burstQueue = NULL;
+    }
+#if CORE_EVENTQUEUE_SIGNALS
+    queue->signalTail = queue->signalHead; // Drop removed signals left in ring
+#endif
+}
+
+#if CORE_EVENTQUEUE_SIGNALS
+/** @brief  Check if next event of a queue is a signal, removed signals at the front of ring are skipped
+ *  @details Interrupts must be disabled.
+ *  @param  queue   Event queue that has events
+ *  @return TRUE if signal at ring tail was posted before the first event of byte queue
+ */
+static teBool eventSignalFirst(tsEventQueue *queue)
+{
+    tsEventPost post;
+
+    if (0 == queue->signalLoad)
+    {
+        return FALSE;
+    }
+
+    while (PROCESS_NONE == (tProcessEnum)queue->signals[SIGNAL_INDEX(queue->signalTail)])
+    {
+        queue->signalTail++;
+    }
+
+    if (DEQUE_IS_EMPTY(&queue->queue))
+    {
+        return TRUE;
+    }
+
+    dequePeek(&queue->queue, 0, &post, sizeof(post));
+
+    return ((int8_t)(uint8_t)(queue->signalTail - post.sequence) < 0) ? TRUE : FALSE;
+}
+
+/** @brief  Find first waiting signal of a process in ring
+ *  @details Interrupts must be disabled.
+ *  @param  queue       Event queue
+ *  @param  process     Destination process
+ *  @param  event       Event to find
+ *  @param  anyEvent    TRUE to match any event of process
+ *  @param  position    Ring position of signal is placed here
+ *  @return TRUE if a matching signal is found
+ */
+static teBool eventSignalFind(const tsEventQueue *queue, const tsProcess *process, tEventEnum event, teBool anyEvent, uint8_t *position)
+{
+    uint8_t idx;
+    uint32_t signal;
+
+    for (idx = queue->signalTail; idx != queue->signalHead; idx++)
+    {
+        signal = queue->signals[SIGNAL_INDEX(idx)];
+        if (((tProcessEnum)signal == process->enumeration) && (anyEvent ? (EVENT_PT != (tEventEnum)(signal >> 16)) : ((tEventEnum)(signal >> 16) == event)))
+        {
+            *position = idx;
+            return TRUE;
+        }
+    }
+
+    return FALSE;
+}
+#endif
+
+/** @brief  Find a waiting event of a process in a queue and remove it if requested
+ *  @details Interrupts must be disabled. Removal moves all events of the queue once to keep their order.
+ *  @param  queue       Event queue
+ *  @param  process     Destination process
+ *  @param  event       Event to find
+ *  @param  anyEvent    TRUE to match any event of process
+ *  @param  removed     Information of first matching event is placed here and event is removed from queue, its
+ *                      event buffer is released. NULL to only check.
+ *  @return TRUE if a matching event is found
+ */
+static teBool eventQueueFind(tsEventQueue *queue, tsProcess *process, tEventEnum event, teBool anyEvent, tsEventPost *removed)
+{
+    teBool remove = removed ? TRUE : FALSE;
+    uint8_t chunk[16];
+    tsEventPost post;
+    uint16_t offset = 0;
+    uint16_t count  = queue->evCntLoad;
+    uint16_t length;
+    teBool found = FALSE;
+    void *buf;
+#if CORE_EVENTQUEUE_SIGNALS
+    uint32_t signal;
+    uint8_t position;
+
+    count = (uint16_t)(count - queue->signalLoad);
+    if (TRUE == eventSignalFind(queue, process, event, anyEvent, &position))
+    {
+        if (FALSE == remove)
+        {
+            return TRUE;
+        }
+
+        // Signal is the oldest match unless a matching event with data was posted before it
+        for (; count; count--)
+        {
+            dequePeek(&queue->queue, offset, &post, sizeof(post));
+            if ((post.destination == process->enumeration) && (anyEvent ? (EVENT_PT != post.event) : (post.event == event)))
+            {
+                break;
+            }
+            offset += sizeof(post) + post.length;
+        }
+
+        if ((0 == count) || ((int8_t)(uint8_t)(position - post.sequence) < 0))
+        {
+            signal                                    = queue->signals[SIGNAL_INDEX(position)];
+            queue->signals[SIGNAL_INDEX(position)]    = PROCESS_NONE; // Skipped when it reaches the front
+            queue->signalLoad--;
+            removed->destination = (tProcessEnum)signal;
+            removed->source      = (tProcessEnum)(signal >> 8);
+            removed->event       = (tEventEnum)(signal >> 16);
+            removed->flags       = (uint8_t)(signal >> 24);
+            removed->length      = 0;
+            removed->sequence    = position;
+            if (removed->event < PROCESS_COALESCE_MAX)
+            {
+                process->coalescePending &= ~EVENT_MASK(removed->event);
+            }
+            found = TRUE;
+            count = 0; // Byte queue stays as it is
+        }
+        else
+        {
+            count  = (uint16_t)(queue->evCntLoad - queue->signalLoad);
+            offset = 0;
+        }
+    }
+#endif
+
+    for (; count; count--)
+    {
+        dequePeek(&queue->queue, remove ? 0 : offset, &post, sizeof(post));
+        if ((FALSE == found) && (post.destination == process->enumeration) && (anyEvent ? (EVENT_PT != post.event) : (post.event == event)))
+        {
+            found = TRUE;
+            if (FALSE == remove)
+            {
+                return TRUE;
+            }
+
+            *removed = post;
+            dequeRemFront(&queue->queue, sizeof(post));
+            if (post.flags & EVENT_FLAG_REF)
+            {
+                dequePopFront(&queue->queue, &buf, sizeof(buf));
+                eventBufRelease(buf);
+            }
+            else
+            {
+                dequeRemFront(&queue->queue, post.length);
+            }
+            if ((0 == post.length) && (post.event < PROCESS_COALESCE_MAX))
+            {
+                process->coalescePending &= ~EVENT_MASK(post.event);
+            }
+            continue;
+        }
+
+        if (FALSE == remove)
+        {
+            offset += sizeof(post) + post.length;
+            continue;
+        }
+
+        // Move event from front to back
+        dequeRemFront(&queue->queue, sizeof(post));
+        dequePushBack(&queue->queue, &post, sizeof(post));
+        for (length = post.length; length; length -= MIN(length, sizeof(chunk)))
+        {
+            dequePopFront(&queue->queue, chunk, MIN(length, sizeof(chunk)));
+            dequePushBack(&queue->queue, chunk, MIN(length, sizeof(chunk)));
+        }
+    }
+
+    if (found)
+    {
+        queue->evCntLoad--;
+        processUnload(process);
+        if (0 == queue->evCntLoad)
+        {
+            eventQueueDrained(queue);
+        }
+    }
+
+    return found;
+}
+
+/** @brief  Apply quota of destination before an event is queued
+ *  @details Interrupts must be disabled.
+ *  @param  process Destination process that has a quota
+ *  @param  queue   Queue of destination
+ *  @param  post    Event that will be queued
+ *  @param  result  Return value of post when event is not queued, EVENT_POST_DROPPED when policy dropped it
+ *  @return TRUE if event can be queued
+ */
+static teBool eventQuota(tsProcess *process, tsEventQueue *queue, const tsEventPost *post, uint8_t *result)
+{
+    tsEventQuota *quota = process->quota;
+    tsEventPost removed;
+
+    while ((quota->limit && (process->evCntLoad >= quota->limit)) || (FALSE == eventQueueRoom(queue, post->length)))
+    {
+        if (eOverloadDropOldest == quota->policy)
+        {
+            if (TRUE == eventQueueFind(queue, process, EVENT_NONE, TRUE, &removed))
+            {
+                quota->drops.dropOldest++;
+                eventDrops.dropOldest++;
+                if (rcosTrace)
+                {
+                    traceRecordRaw(rcosTrace->cycles(), eTraceDropOld, removed.source, removed.destination, removed.event);
+                }
+                continue;
+            }
+        }
+        else if (eOverloadCoalesce == quota->policy)
+        {
+            if ((0 == post->length) && (TRUE == eventQueueFind(queue, process, post->event, FALSE, NULL)))
+            {
+                quota->drops.coalesced++;
+                eventDrops.coalesced++;
+                if (rcosTrace)
+                {
+                    traceRecordRaw(rcosTrace->cycles(), eTraceCoalesce, post->source, post->destination, post->event);
+                }
+                *result = EXIT_SUCCESS; // Same event is waiting, it will be handled once
+                return FALSE;
+            }
+        }
+        else if (eOverloadReject == quota->policy)
+        {
+            quota->drops.rejected++;
+            eventDrops.rejected++;
+            if (rcosTrace)
+            {
+                traceRecordRaw(rcosTrace->cycles(), eTraceDrop, post->source, post->destination, post->event);
+            }
+            if (quota->reject)
+            {
+                quota->reject(post->destination, post->event);
+            }
+            *result = EVENT_POST_DROPPED;
+            return FALSE;
+        }
+
+        quota->drops.dropNew++;
+        eventDrops.dropNew++;
+        if (rcosTrace)
+        {
+            traceRecordRaw(rcosTrace->cycles(), eTraceDrop, post->source, post->destination, post->event);
+        }
+        *result = EVENT_POST_DROPPED;
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+/** @brief  Announce that thread of a group goes to sleep, interrupts must be disabled
+ *  @param  group   Executor group of calling thread
+ *  @return FALSE if posts from other groups are waiting and thread must not sleep
+ */
+static teBool executorIdleBegin(uint8_t group)
+{
+    tsExecutorGroup *state;
+
+    if (NULL == rcosExecutor)
+    {
+        return TRUE;
+    }
+
+    state = &rcosExecutor->groups[group];
+    __atomic_store_n(&state->sleeping, 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST); // Producers check sleeping after their post, see executorPost
+
+    return (__atomic_load_n(&state->ring[state->tail & (rcosExecutor->ringSize - 1)].sequence, __ATOMIC_ACQUIRE) == (state->tail + 1)) ? FALSE : TRUE;
+}
+
+/// @brief  Thread of a group is awake again
+static void executorIdleEnd(uint8_t group)
+{
+    if (rcosExecutor)
+    {
+        __atomic_store_n(&rcosExecutor->groups[group].sleeping, 0, __ATOMIC_RELAXED);
+    }
+}
+
+/// @brief  Wake thread of a group if it sleeps, interrupts must be disabled
+static void executorWake(uint8_t group)
+{
+    if (__atomic_load_n(&rcosExecutor->groups[group].sleeping, __ATOMIC_RELAXED))
+    {
+        rcosExecutor->wake(group);
+    }
+}
+
+/** @brief  Place a post into ring of another executor group, its thread moves it into process queues
+ *  @details Lock-free for any number of producer threads like the isr ingress ring, a full ring drops the post and
+ *           returns EXIT_FAILURE, an event buffer is then released by the caller like every failed post.
+ *  @param  group   Executor group of destination
+ *  @param  post    Event information
+ *  @param  data    Data of event, a buffer pointer for EVENT_FLAG_REF
+ *  @param  fifo    FALSE to post to the front of queue
+ *  @param  traced  TRUE if post is already recorded in trace
+ */
+static uint8_t executorPost(uint8_t group, const tsEventPost *post, const void *data, teBool fifo, teBool traced)
+{
+    tsExecutorGroup *state = &rcosExecutor->groups[group];
+    uint32_t position      = __atomic_load_n(&state->head, __ATOMIC_RELAXED);
+    tsExecutorSlot *slot;
+    int32_t lap;
+
+    for (;;)
+    {
+        slot = &state->ring[position & (rcosExecutor->ringSize - 1)];
+        lap  = (int32_t)(__atomic_load_n(&slot->sequence, __ATOMIC_ACQUIRE) - position);
+        if (0 == lap)
+        {
+            if (__atomic_compare_exchange_n(&state->head, &position, position + 1, FALSE, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+            {
+                break;
+            }
+        }
+        else if (lap < 0)
+        {
+            __atomic_add_fetch(&state->ringFull, 1, __ATOMIC_RELAXED);
+            if (rcosTrace)
+            {
+                traceRecord(rcosTrace->cycles(), eTraceDrop, post->source, post->destination, post->event);
+            }
+            return EXIT_FAILURE;
+        }
+        else
+        {
+            position = __atomic_load_n(&state->head, __ATOMIC_RELAXED);
+        }
+    }
+
+    if (rcosTrace && (FALSE == traced))
+    {
+        traceRecord(rcosTrace->cycles(), eTracePost, post->source, post->destination, post->event);
+    }
+
+    slot->post = *post;
+    slot->fifo = fifo;
+    memcpy(slot->data, data, post->length);
+    __atomic_store_n(&slot->sequence, position + 1, __ATOMIC_RELEASE);
+
+    __atomic_thread_fence(__ATOMIC_SEQ_CST); // Pairs with executorIdleBegin, either the post or sleeping is seen
+    if (__atomic_load_n(&state->sleeping, __ATOMIC_RELAXED))
+    {
+        globalIntDisable();
+        rcosExecutor->wake(group);
+        globalIntEnable();
+    }
+
+    return EXIT_SUCCESS;
+}
+
+/** @brief  Put a post into a process queue, the common part of events and topic records
+ *  @details Applies coalescing, quota and overflow checks of owner, updates load counters and wakes
+ *           the executor thread of queue.
+ *  @param  process Owner of record, destination of an event or publisher of a topic record, NULL for none
+ *  @param  queue   Queue of owner
+ *  @param  post    Event information, length includes topic pointer of a topic record
+ *  @param  data    Data of event, a buffer pointer for EVENT_FLAG_REF
+ *  @param  topic   Topic placed after data, NULL for events
+ *  @param  fifo    TRUE: back of the queue, FALSE: front of the queue
+ *  @param  traced  TRUE if post is already recorded in trace
+ */
+static uint8_t eventEnqueue(tsProcess *process, tsEventQueue *queue, tsEventPost *post, const void *data, tsTopic *topic, teBool fifo, teBool traced)
+{
+    uint8_t length = (uint8_t)(post->length - (topic ? sizeof(topic) : 0));
+    teBool coalescable;
+    uint8_t result;
+
+    coalescable = (process && (0 == post->length) && (post->event < PROCESS_COALESCE_MAX) && (process->coalesce & EVENT_MASK(post->event))) ? TRUE : FALSE;
+
+    globalIntDisable();
+
+    if (coalescable && (process->coalescePending & EVENT_MASK(post->event)))
+    {
+        process->evCoalesced++;
+        eventDrops.coalesced++;
+        if (rcosTrace)
+        {
+            traceRecordRaw(rcosTrace->cycles(), eTraceCoalesce, post->source, post->destination, post->event);
+        }
+        globalIntEnable();
+        return EXIT_SUCCESS; // Same event is waiting, it will be handled once
+    }
+
+    if (process && process->quota && (EVENT_PT != post->event)) // Protothread runs are bounded by thread slots, never dropped
+    {
+        if (FALSE == eventQuota(process, queue, post, &result))
+        {
+            globalIntEnable();
+            return result;
+        }
+    }
+    else if (FALSE == eventQueueRoom(queue, post->length))
+    {
+        coreSysReset(CORE_RESET_EVENT_OVERFLOW, ((uint32_t)post->destination << 16) | post->event);
+    }
+
+    if (coalescable)
+    {
+        process->coalescePending |= EVENT_MASK(post->event);
+    }
+
+    if (0 == queue->evCntLoad)
+    {
+        ldlInsertTail(eventReadyList(queue), queue);
+    }
+
+#if CORE_EVENTQUEUE_SIGNALS
+    if ((0 == post->length) && ((uint8_t)(queue->signalHead - queue->signalTail) < CORE_EVENTQUEUE_SIGNALS))
+    {
+        if (TRUE == fifo)
+        {
+            queue->signals[SIGNAL_INDEX(queue->signalHead++)] = SIGNAL_PACK(post);
+        }
+        else
+        {
+            queue->signals[SIGNAL_INDEX(--queue->signalTail)] = SIGNAL_PACK(post);
+        }
+        queue->signalLoad++;
+        queue->signalMax = MAX(queue->signalMax, queue->signalLoad);
+    }
+    else
+#endif
+    if (TRUE == fifo)
+    {
+#if CORE_EVENTQUEUE_SIGNALS
+        post->sequence = queue->signalHead; // Signals posted so far are dispatched first
+#endif
+        dequePushBack(&queue->queue, post, sizeof(*post));
+        dequePushBack(&queue->queue, data, length);
+        if (topic)
+        {
+            dequePushBack(&queue->queue, &topic, sizeof(topic));
+        }
+    }
+    else
+    {
+#if CORE_EVENTQUEUE_SIGNALS
+        post->sequence = queue->signalTail; // Dispatched before every waiting signal
+#endif
+        if (topic)
+        {
+            dequePushFront(&queue->queue, &topic, sizeof(topic));
+        }
+        dequePushFront(&queue->queue, data, length);
+        dequePushFront(&queue->queue, post, sizeof(*post));
+    }
+
+    queue->evCntLoad++;
+    queue->evCntMax = MAX(queue->evCntMax, queue->evCntLoad);
+    if (process)
+    {
+        process->evCntLoad++;
+        process->evCntMax = MAX(process->evCntMax, process->evCntLoad);
+        if (process->quota && process->quota->high && (process->evCntLoad >= process->quota->high))
+        {
+            process->quota->congested = TRUE;
+        }
+    }
+
+    if (topic)
+    {
+        topic->published++;
+    }
+
+    if (rcosDegraded && (queue == &eventQueue) && ((uint32_t)DEQUE_LOAD(&queue->queue) * 100u >= (uint32_t)rcosDegraded->high * queue->queue.size))
+    {
+        rcosDegraded->active = TRUE;
+    }
+
+    if (rcosTrace && (FALSE == traced))
+    {
+        traceRecordRaw(rcosTrace->cycles(), (TRUE == isIsrActive()) ? eTracePostIsr : eTracePost, post->source, post->destination, post->event);
+    }
+
+    if (rcosExecutor && (queue->group != executorGroup))
+    {
+        executorWake(queue->group); // Posted by an isr or a timer
+    }
+
+    globalIntEnable();
+
+    return EXIT_SUCCESS;
+}
+
+/** @brief  Place an event into the queue
+ *  @details Buffer of an EVENT_FLAG_REF post belongs to the event only when EXIT_SUCCESS is returned, it is released
+ *           after the event is handled or dropped from the queue. Otherwise caller still holds its reference and
+ *           must release it, eventPostRaw never releases a buffer.
+ *  @param  fifo    TRUE: back of the queue, FALSE: front of the queue
+ *  @param  flags   EVENT_FLAG_..., with EVENT_FLAG_REF data holds an event buffer pointer
+ *  @return EXIT_SUCCESS if queued, EVENT_POST_DROPPED if destination does not exist or its quota dropped it,
+ *          EXIT_FAILURE if it cannot be queued
+ */
+static uint8_t eventPostRaw(tProcessEnum source, tProcessEnum destination, tEventEnum event, const void *data, uint8_t length, teBool fifo, uint8_t flags)
+{
+    tsEventPost post = {source, destination, event, length, (uint8_t)(flags & ~EVENT_FLAG_TRACED)};
+    tsProcess *process;
+
+    if ((EVENT_PT == event) && ((source != destination) || length))
+    {
+        return EXIT_FAILURE;
+    }
+
+    process = processFind(destination);
+    if (NULL == process)
+    {
+        eventDrops.noProcess++;
+        return EVENT_POST_DROPPED; // Nobody to receive
+    }
+
+    if ((NULL == process->handlerCurrent) && (EVENT_PT != event))
+    {
+        return EXIT_FAILURE;
+    }
+
+    if (rcosExecutor && (process->group != executorGroup) && (FALSE == isIsrActive()))
+    {
+        return executorPost(process->group, &post, data, fifo, (flags & EVENT_FLAG_TRACED) ? TRUE : FALSE);
+    }
+
+    return eventEnqueue(process, process->queue ? process->queue : groupQueue(process->group), &post, data, NULL, fifo, (flags & EVENT_FLAG_TRACED) ? TRUE : FALSE);
+}
+
+/// @brief  Check if a post is queued or dropped on purpose, only an EXIT_FAILURE post is worth retrying
+static teBool eventPostDone(uint8_t result)
+{
+    return ((EXIT_SUCCESS == result) || (EVENT_POST_DROPPED == result)) ? TRUE : FALSE;
+}
+
+/// @brief  Publisher process that owns topic records it posts, NULL outside handlers of running executor group
+static tsProcess *topicOwner(tProcessEnum publisher)
+{
+    tsProcess *process = processFind(publisher);
+
+    return (process && (process->group == executorGroup)) ? process : NULL;
+}
+
+/** @brief  Insert a topic record into queue of publisher, topic pointer is placed after data
+ *  @details Record takes priority, quota and load of publisher like an event posted to it. Records published
+ *           outside a handler go to the queue of running executor group without an owner.
+ *  @param  topic   Topic pointer
+ *  @param  data    Data of event, a buffer pointer for EVENT_FLAG_REF
+ *  @param  length  Length of data
+ *  @param  flags   EVENT_FLAG_... of record
+ */
+static uint8_t topicPost(tsTopic *topic, const void *data, uint8_t length, uint8_t flags)
+{
+    tsEventPost post   = {eventCurrent.destination, PROCESS_NONE, topic->event, (uint8_t)(length + sizeof(topic)), (uint8_t)(flags | EVENT_FLAG_TOPIC)};
+    tsProcess *process = topicOwner(eventCurrent.destination);
+
+    return eventEnqueue(process, (process && process->queue) ? process->queue : groupQueue(executorGroup), &post, data, topic, TRUE, FALSE);
+}
+
+/** @brief      Take next event of the highest priority queue into eventCurrent and eventData
+ *  @details    Queues of the same priority are served round-robin, CORE_EVENTQUEUE_BURST events at a time.
+ *              Interrupts must be disabled.
+ *  @return     FALSE if there is no event
+ */
+static teBool eventPop(void)
+{
+    tsEventReady *lists = groupReady(executorGroup);
+    uint8_t level       = CORE_PRIORITY_LEVELS;
+    tsEventQueue *queue;
+    tsLdl *ready;
+#if CORE_EVENTQUEUE_SIGNALS
+    uint32_t signal;
+#endif
+
+    do
+    {
+        if (0 == level)
+        {
+            return FALSE;
+        }
+        ready = &lists->list[--level];
+    } while (NULL == ready->head);
+
+    queue = (tsEventQueue *)ready->head;
+#if CORE_EVENTQUEUE_SIGNALS
+    if (TRUE == eventSignalFirst(queue))
+    {
+        signal = queue->signals[SIGNAL_INDEX(queue->signalTail++)];
+        queue->signalLoad--;
+        eventCurrent.destination = (tProcessEnum)signal;
+        eventCurrent.source      = (tProcessEnum)(signal >> 8);
+        eventCurrent.event       = (tEventEnum)(signal >> 16);
+        eventCurrent.flags       = (uint8_t)(signal >> 24);
+        eventCurrent.length      = 0;
+    }
+    else
+#endif
+    {
+        dequePopFront(&queue->queue, &eventCurrent, sizeof(eventCurrent));
+        dequePopFront(&queue->queue, eventData, eventCurrent.length);
+    }
+    queue->evCntLoad--;
+
+    eventBuf       = NULL;
+    eventBufLength = 0;
+    if (eventCurrent.flags & EVENT_FLAG_REF)
+    {
+        memcpy(&eventBuf, eventData, sizeof(eventBuf));
+        eventBufLength = EVENT_BUF_HEADING(eventBuf)->length;
+    }
+
+    if (queue != lists->burstQueue)
+    {
+        lists->burstQueue = queue;
+        lists->burst      = 0;
+    }
+    lists->burst++;
+
+    if (0 == queue->evCntLoad)
+    {
+        eventQueueDrained(queue);
+    }
+    else if (CORE_EVENTQUEUE_BURST && (lists->burst >= CORE_EVENTQUEUE_BURST))
+    {
+        ldlPopHead(ready);
+        ldlInsertTail(ready, queue);
+        lists->burstQueue = NULL;
+    }
+
+    return TRUE;
+}
+
+/// @brief  Index of a registered device, RECORD_DEVICE_NONE if it is not registered
+static uint8_t recordDeviceIndex(const void *device)
+{
+    uint8_t idx;
+
+    for (idx = 0; idx < rcosRecorder->deviceCount; idx++)
+    {
+        if (rcosRecorder->devices[idx] == device)
+        {
+            return idx;
+        }
+    }
+
+    return RECORD_DEVICE_NONE;
+}
+
+/// @brief  Copy bytes into recorder ring, interrupts must be disabled and ring must have space
+static void recordRingWrite(const uint8_t *data, uint16_t length)
+{
+    while (length--)
+    {
+        rcosRecorder->ring[rcosRecorder->head] = *data++;
+        rcosRecorder->head = (uint16_t)((rcosRecorder->head + 1) % rcosRecorder->size);
+        rcosRecorder->count++;
+    }
+}
+
+/// @brief  Place an input record into recorder ring if recording, works in and out of ISR
+static void recordPut(teRecordKind kind, uint8_t id, tEventEnum event, const void *data, uint8_t length)
+{
+    uint32_t tick;
+    uint8_t heading[RECORD_HEADING_SIZE];
+
+    globalIntDisable();
+    if (eRecordOn != rcosRecorder->mode)
+    {
+        globalIntEnable();
+        return;
+    }
+    if ((uint32_t)rcosRecorder->size - rcosRecorder->count < RECORD_HEADING_SIZE + length)
+    {
+        rcosRecorder->lost++;
+        globalIntEnable();
+        return;
+    }
+
+    tick       = timerTickCount - rcosRecorder->start;
+    heading[0] = (uint8_t)tick;
+    heading[1] = (uint8_t)(tick >> 8);
+    heading[2] = (uint8_t)(tick >> 16);
+    heading[3] = (uint8_t)(tick >> 24);
+    heading[4] = (uint8_t)kind;
+    heading[5] = id;
+    heading[6] = (uint8_t)event;
+    heading[7] = length;
+    recordRingWrite(heading, sizeof(heading));
+    recordRingWrite(data, length);
+    globalIntEnable();
+}
+
+/** @brief  Record an event posted from an isr
+ *  @return TRUE if the post must be ignored as inputs are replayed
+ */
+static teBool recordIsr(teRecordKind kind, tProcessEnum destination, tEventEnum event, const void *data, uint8_t length)
+{
+    if ((NULL == rcosRecorder) || (eRecordOff == rcosRecorder->mode))
+    {
+        return FALSE;
+    }
+    if (eRecordReplay == rcosRecorder->mode)
+    {
+        return TRUE;
+    }
+
+    recordPut(kind, destination, event, data, length);
+
+    return FALSE;
+}
+
+/// @brief  Read next record to replay from storage, live inputs stay ignored when there is none
+static void replayLoad(void)
+{
+    uint8_t heading[RECORD_HEADING_SIZE];
+    tsRecorder *recorder = rcosRecorder;
+
+    recorder->nextReady = 0;
+    recorder->nextTaken = 0;
+
+    if ((recorder->offset + RECORD_HEADING_SIZE <= recorder->length) &&
+        (EXIT_SUCCESS == devMemRead(recorder->mem, recorder->address + recorder->offset, heading, RECORD_HEADING_SIZE)))
+    {
+        recorder->next.tick   = heading[0] | ((uint32_t)heading[1] << 8) | ((uint32_t)heading[2] << 16) | ((uint32_t)heading[3] << 24);
+        recorder->next.kind   = heading[4];
+        recorder->next.id     = heading[5];
+        recorder->next.event  = heading[6];
+        recorder->next.length = heading[7];
+
+        // Erased or partially written storage ends the records
+        if ((recorder->next.kind < eRecordKindCount) &&
+            (recorder->offset + RECORD_HEADING_SIZE + recorder->next.length <= recorder->length) &&
+            ((0 == recorder->next.length) || (EXIT_SUCCESS == devMemRead(recorder->mem, recorder->address + recorder->offset + RECORD_HEADING_SIZE, recorder->nextData, recorder->next.length))))
+        {
+            recorder->offset += RECORD_HEADING_SIZE + recorder->next.length;
+            recorder->nextReady = 1;
+        }
+    }
+}
+
+/// @brief  Check if next record to replay is due
+static teBool replayDue(void)
+{
+    return (rcosRecorder->nextReady && ((int32_t)(timerTickCount - rcosRecorder->start - rcosRecorder->next.tick) >= 0)) ? TRUE : FALSE;
+}
+
+/// @brief  Feed due records, records of data received by devices wait until devComReceive takes them
+static void replayFeed(void)
+{
+    tsRecorder *recorder = rcosRecorder;
+    uint8_t id;
+
+    while (recorder && (eRecordReplay == recorder->mode) && (TRUE == replayDue()))
+    {
+        id = recorder->next.id;
+        switch (recorder->next.kind)
+        {
+        case eRecordIsrPost:
+        case eRecordIsrPostFront:
+            if (FALSE == eventPostDone(eventPostRaw(id, id, recorder->next.event, recorder->nextData, recorder->next.length, (eRecordIsrPost == recorder->next.kind) ? TRUE : FALSE, 0)))
+            {
+                return; // Queue is full, try again on next loop
+            }
+            break;
+
+        case eRecordIoGet:
+            if (id < recorder->deviceCount)
+            {
+                recorder->values[id] = recorder->nextData[0] | ((uint32_t)recorder->nextData[1] << 8) | ((uint32_t)recorder->nextData[2] << 16) | ((uint32_t)recorder->nextData[3] << 24);
+                recorder->known |= 1ul << id;
+            }
+            break;
+
+        default:
+            return;
+        }
+        replayLoad();
+    }
+}
+
+/// @brief  Ticks until next record to replay is due, CORE_TIMER_PERIOD_MAX if there is nothing to wait for
+static uint32_t replayNext(void)
+{
+    uint32_t elapsed;
+
+    if ((NULL == rcosRecorder) || (eRecordReplay != rcosRecorder->mode) || (0 == rcosRecorder->nextReady))
+    {
+        return CORE_TIMER_PERIOD_MAX;
+    }
+
+    elapsed = timerTickCount - rcosRecorder->start;
+    if ((int32_t)(elapsed - rcosRecorder->next.tick) >= 0)
+    {
+        return CORE_TIMER_PERIOD_MAX; // Due, waits for devComReceive
+    }
+
+    return rcosRecorder->next.tick - elapsed;
+}
+
+/** @brief  Insert an event into isr ingress ring
+ *  @param  flags   ISR_SLOT_CORE for events of core itself, 0 for external inputs
+ */
+static uint8_t isrRingPost(tProcessEnum destination, tEventEnum event, const void *data, uint8_t length, uint8_t flags)
+{
+    uint32_t position = __atomic_load_n(&isrRingHead, __ATOMIC_RELAXED);
+    tsIsrSlot *slot;
+    int32_t lap;
+
+    if ((length > CORE_ISR_EVENT_DATA) || (EVENT_PT == event))
+    {
+        return EXIT_FAILURE;
+    }
+
+    for (;;)
+    {
+        slot = &isrRing[position & (CORE_ISR_RING_SIZE - 1)];
+        lap  = (int32_t)(__atomic_load_n(&slot->sequence, __ATOMIC_ACQUIRE) - position);
+        if (0 == lap)
+        {
+            // Slot is free for this position, claim it unless another producer was faster
+            if (__atomic_compare_exchange_n(&isrRingHead, &position, position + 1, FALSE, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+            {
+                break;
+            }
+        }
+        else if (lap < 0)
+        {
+            return EXIT_FAILURE; // coreRun has not taken the event of previous lap yet
+        }
+        else
+        {
+            position = __atomic_load_n(&isrRingHead, __ATOMIC_RELAXED);
+        }
+    }
+
+    slot->post.source      = destination;
+    slot->post.destination = destination;
+    slot->post.event       = event;
+    slot->post.length      = length;
+    slot->post.flags       = flags;
+    slot->time             = rcosTrace ? rcosTrace->cycles() : 0;
+    memcpy(slot->data, data, length);
+    __atomic_store_n(&slot->sequence, position + 1, __ATOMIC_RELEASE);
+
+    return EXIT_SUCCESS;
+}
+
+/// @brief  Check if isr ingress ring has an event waiting for coreRun
+static teBool isrRingPending(void)
+{
+    return (__atomic_load_n(&isrRing[isrRingTail & (CORE_ISR_RING_SIZE - 1)].sequence, __ATOMIC_ACQUIRE) == (isrRingTail + 1)) ? TRUE : FALSE;
+}
+
+/// @brief  Move events of isr ingress ring to process queues in posted order, at most one lap of the ring at a time
+static void isrRingDrain(void)
+{
+    uint32_t count = CORE_ISR_RING_SIZE;
+    tsIsrSlot *slot;
+
+    while (count-- && (TRUE == isrRingPending()))
+    {
+        slot = &isrRing[isrRingTail & (CORE_ISR_RING_SIZE - 1)];
+        if (rcosTrace)
+        {
+            traceRecord(slot->time, eTracePostIsr, slot->post.source, slot->post.destination, slot->post.event);
+        }
+        if ((slot->post.flags & ISR_SLOT_CORE) || (FALSE == recordIsr(eRecordIsrPost, slot->post.destination, slot->post.event, slot->data, slot->post.length)))
+        {
+            eventPostRaw(slot->post.source, slot->post.destination, slot->post.event, slot->data, slot->post.length, TRUE, EVENT_FLAG_TRACED);
+        }
+        __atomic_store_n(&slot->sequence, isrRingTail + CORE_ISR_RING_SIZE, __ATOMIC_RELEASE);
+        isrRingTail++;
+    }
+}
+
+/// @brief  Move posts of other groups to process queues in posted order, at most one lap of the ring at a time
+static void executorDrain(uint8_t group)
+{
+    tsExecutorGroup *state;
+    tsExecutorSlot *slot;
+    uint32_t count;
+    void *buf;
+
+    if (NULL == rcosExecutor)
+    {
+        return;
+    }
+
+    state = &rcosExecutor->groups[group];
+    for (count = rcosExecutor->ringSize; count; count--)
+    {
+        slot = &state->ring[state->tail & (rcosExecutor->ringSize - 1)];
+        if (__atomic_load_n(&slot->sequence, __ATOMIC_ACQUIRE) != (state->tail + 1))
+        {
+            break;
+        }
+        if ((EXIT_SUCCESS != eventPostRaw(slot->post.source, slot->post.destination, slot->post.event, slot->data, slot->post.length, (teBool)slot->fifo, (uint8_t)(slot->post.flags | EVENT_FLAG_TRACED))) &&
+            (slot->post.flags & EVENT_FLAG_REF))
+        {
+            memcpy(&buf, slot->data, sizeof(buf));
+            eventBufRelease(buf); // Reference carried by the slot is not taken by any queue
+        }
+        __atomic_store_n(&slot->sequence, state->tail + rcosExecutor->ringSize, __ATOMIC_RELEASE);
+        state->tail++;
+    }
+}
+
+/// @brief  Budget of a process in ticks, 0 for no limit
+static uint16_t deadlineBudget(const tsProcess *process)
+{
+    if (process->budget)
+    {
+        return process->budget;
+    }
+
+    return rcosDeadline ? rcosDeadline->budget : 0;
+}
+
+/// @brief  Warn about running call once it passes its budget, called inside rcosTickIsr
+static void deadlineWarn(void)
+{
+    tsProcess *process = dispatchProcess;
+    uint16_t budget    = deadlineBudget(process);
+    uint32_t elapsed   = timerTickCount - dispatchStart;
+    tsOverrun overrun;
+
+    if ((0 == budget) || (elapsed <= budget))
+    {
+        return;
+    }
+
+    dispatchWarned   = 1;
+    overrun.tick     = timerTickCount;
+    overrun.duration = (uint16_t)MIN(elapsed, UINT16_MAX);
+    overrun.process  = process->enumeration;
+    overrun.event    = eventCurrent.event;
+
+    if (rcosDeadline->hook)
+    {
+        rcosDeadline->hook(&overrun);
+    }
+    if (PROCESS_NONE != rcosDeadline->supervisor)
+    {
+        isrRingPost(rcosDeadline->supervisor, rcosDeadline->event, &overrun, sizeof(overrun), ISR_SLOT_CORE);
+    }
+}
+
+/// @brief  Record a finished call that exceeded its budget
+static void deadlineOverrunRecord(tsProcess *process, uint32_t elapsed)
+{
+    tsOverrun *overrun;
+
+    process->overruns++;
+
+    if (rcosTrace)
+    {
+        traceRecord(rcosTrace->cycles(), eTraceOverrun, (tProcessEnum)MIN(elapsed, 0xFFu), process->enumeration, eventCurrent.event);
+    }
+
+    if ((NULL == rcosDeadline) || (0 == rcosDeadline->size))
+    {
+        return;
+    }
+
+    globalIntDisable(); // Executor threads share the log
+    overrun           = &rcosDeadline->log[rcosDeadline->head];
+    overrun->tick     = timerTickCount;
+    overrun->duration = (uint16_t)MIN(elapsed, UINT16_MAX);
+    overrun->process  = process->enumeration;
+    overrun->event    = eventCurrent.event;
+
+    rcosDeadline->head = (uint16_t)((rcosDeadline->head + 1) % rcosDeadline->size);
+    rcosDeadline->count++;
+    globalIntEnable();
+}
+
+/// @brief  Process one tick on all timer wheels
+static void timerTick(void)
+{
+    tsTimerCallBack *callBack;
+    tsTimerEvent *timerEvent;
+    tsTimerHeading *timer;
+    tsLdlItem *slot;
+
+    timerTickCount++;
+
+    slot = timerWheelAdvance(&timerGenericWheel);
+    while (NULL != (timer = timerWheelPop(&timerGenericWheel, slot)))
+    {
+        timer->_cnt = 0;
+    }
+
+    slot = timerWheelAdvance(&timerCallBackWheel);
+    while (NULL != (timer = timerWheelPop(&timerCallBackWheel, slot)))
+    {
+        callBack = (tsTimerCallBack *)timer;
+        if (callBack->deferred)
+        {
+            callBack->_pending = 1;
+            ldlInsertTail(&timerDeferred, callBack);
+            continue;
+        }
+        if (rcosTrace)
+        {
+            traceRecord(rcosTrace->cycles(), eTraceCallBack, PROCESS_NONE, PROCESS_NONE, EVENT_NONE);
+        }
+        timer->_cnt = callBack->callBack ? callBack->callBack(callBack->parameter) : 0;
+        if (timer->_cnt)
+        {
+            timerWheelStart(&timerCallBackWheel, timer, timer->_cnt, callBack->slack);
+        }
+    }
+
+    slot = timerWheelAdvance(&timerEventWheel);
+    while (NULL != (timer = timerWheelPop(&timerEventWheel, slot)))
+    {
+        timerEvent = (tsTimerEvent *)timer;
+        if (rcosTrace)
+        {
+            traceRecord(rcosTrace->cycles(), eTraceTimer, timerEvent->post.source, timerEvent->post.destination, timerEvent->post.event);
+        }
+        if (TRUE == eventPostDone(eventPostRaw(timerEvent->post.source, timerEvent->post.destination, timerEvent->post.event, NULL, 0, TRUE, (uint8_t)((timerEvent->post.flags & EVENT_FLAG_SLOT(0x07u)) | EVENT_FLAG_TRACED))))
+        {
+            timer->_cnt = 0;
+        }
+        else
+        {
+            // Retry on next tick only if the queue could not take it, an event dropped by quota counts as delivered
+            timerWheelStart(&timerEventWheel, timer, 1, 0);
+        }
+    }
+
+    if (rcosDeadline && dispatchProcess && (0 == dispatchWarned))
+    {
+        deadlineWarn();
+    }
+}
+
+/// @brief  Call expired deferred callbacks, callbacks expiring meanwhile wait for the next loop
+static void timerDeferredRun(void)
+{
+    uint32_t count = timerDeferred.count;
+    tsTimerCallBack *callBack;
+    uint32_t period;
+
+    while (count--)
+    {
+        globalIntDisable();
+        callBack = ldlPopHead(&timerDeferred);
+        if (callBack)
+        {
+            callBack->_pending = 0;
+            callBack->_cnt     = 0;
+        }
+        globalIntEnable();
+
+        if (NULL == callBack)
+        {
+            return; // Stopped meanwhile
+        }
+
+        if (rcosTrace)
+        {
+            traceRecord(rcosTrace->cycles(), eTraceCallBack, PROCESS_NONE, PROCESS_NONE, EVENT_NONE);
+        }
+        period = callBack->callBack(callBack->parameter);
+        if (period)
+        {
+            globalIntDisable();
+            timerWheelStart(&timerCallBackWheel, (tsTimerHeading *)callBack, period, callBack->slack);
+            globalIntEnable();
+        }
+    }
+}
+
+/** @brief  Put a high resolution timer into deadline queue, interrupts must be disabled
+ *  @param  timer       Timer object that is not running
+ *  @param  deadline    Counter value of expiry
+ */
+static void hrTimerInsert(tsHrTimerCallBack *timer, uint32_t deadline)
+{
+    tsHrTimerCallBack *item = (tsHrTimerCallBack *)hrTimerQueue.tail;
+
+    // Walk back from the latest one, timers are mostly started for later than running ones
+    while (item && ((int32_t)(deadline - item->_deadline) < 0))
+    {
+        item = (tsHrTimerCallBack *)item->_li.head;
+    }
+
+    timer->_deadline = deadline;
+    timer->_running  = 1;
+    if (item)
+    {
+        ldlInsertAfter(&hrTimerQueue, item, timer);
+    }
+    else
+    {
+        ldlInsertHead(&hrTimerQueue, timer);
+    }
+}
+
+/// @brief  Take a high resolution timer out of deadline queue and deferred list, interrupts must be disabled
+static void hrTimerRemove(tsHrTimerCallBack *timer)
+{
+    if (timer->_running)
+    {
+        ldlDelete(&hrTimerQueue, timer);
+        timer->_running = 0;
+    }
+    if (timer->_pending)
+    {
+        ldlDelete(&hrTimerDeferred, timer);
+        timer->_pending = 0;
+    }
+}
+
+/** @brief  Restart an expired high resolution timer for its next period, interrupts must be disabled
+ *  @details Period is counted from the last deadline, expiries that have already passed are skipped.
+ */
+static void hrTimerRepeat(tsHrTimerCallBack *timer, uint32_t period)
+{
+    uint32_t now = rcosHrTimer->now();
+    uint32_t deadline;
+
+    if (timer->_running || timer->_pending)
+    {
+        return; // Started again by its own function
+    }
+
+    period   = MIN(period, CORE_TIMER_PERIOD_MAX);
+    deadline = timer->_deadline + period;
+    if ((int32_t)(deadline - now) <= 0)
+    {
+        deadline = now + period;
+    }
+    hrTimerInsert(timer, deadline);
+}
+
+/// @brief  Arm compare interrupt for head of deadline queue, interrupts must be disabled
+static void hrTimerProgram(void)
+{
+    if (hrTimerQueue.head)
+    {
+        rcosHrTimer->program(((tsHrTimerCallBack *)hrTimerQueue.head)->_deadline);
+    }
+    else
+    {
+        rcosHrTimer->cancel();
+    }
+}
+
+/// @brief  Call expired deferred high resolution callbacks, callbacks expiring meanwhile wait for the next loop
+static void hrTimerDeferredRun(void)
+{
+    uint32_t count = hrTimerDeferred.count;
+    tsHrTimerCallBack *timer;
+    uint32_t period;
+
+    while (count--)
+    {
+        globalIntDisable();
+        timer = ldlPopHead(&hrTimerDeferred);
+        if (timer)
+        {
+            timer->_pending = 0;
+        }
+        globalIntEnable();
+
+        if (NULL == timer)
+        {
+            return; // Stopped meanwhile
+        }
+
+        if (rcosTrace)
+        {
+            traceRecord(rcosTrace->cycles(), eTraceCallBack, PROCESS_NONE, PROCESS_NONE, EVENT_NONE);
+        }
+        period = timer->callBack(timer->parameter);
+        if (period)
+        {
+            globalIntDisable();
+            hrTimerRepeat(timer, period);
+            hrTimerProgram();
+            globalIntEnable();
+        }
+    }
+}
+
+/** @brief      Sleep until next timer expiry, replayed input or an interrupt, generic timers are not waited as they only
+ *              change on polling
+ *  @details    Interrupts must be disabled so that an event posted after queues are checked wakes the core up.
+ */
+static void coreIdle(void)
+{
+    rcosTick.program(MIN(MIN(timerWheelNext(&timerCallBackWheel), timerWheelNext(&timerEventWheel)), replayNext()));
+}
+
+/** @brief  Find entry of a process and event pair in profiler table
+ *  @param  process Process enumeration
+ *  @param  event   Event enumeration
+ *  @param  create  TRUE to take an unused entry if pair is not in table
+ *  @return Pointer to entry, NULL if not found or table is full
+ */
+static tsProfilerEntry *profilerEntry(tProcessEnum process, tEventEnum event, teBool create)
+{
+    uint16_t idx = (uint16_t)(((uint32_t)process * 31u + event) % rcosProfiler->size);
+    uint16_t cnt;
+    tsProfilerEntry *entry;
+
+    for (cnt = 0; cnt < rcosProfiler->size; cnt++)
+    {
+        entry = &rcosProfiler->entries[idx];
+        if (0 == entry->count)
+        {
+            if (FALSE == create)
+            {
+                return NULL;
+            }
+            entry->process = process;
+            entry->event   = event;
+            entry->min     = UINT32_MAX;
+            return entry;
+        }
+        if ((entry->process == process) && (entry->event == event))
+        {
+            return entry;
+        }
+        if (++idx == rcosProfiler->size)
+        {
+            idx = 0;
+        }
+    }
+
+    return NULL;
+}
+
+/** @brief  Add one handler call to profiler statistics
+ *  @param  process Process enumeration
+ *  @param  event   Event enumeration
+ *  @param  cycles  Cycles spent in handler
+ */
+static void profilerRecord(tProcessEnum process, tEventEnum event, uint32_t cycles)
+{
+    tsProfilerEntry *entry = profilerEntry(process, event, TRUE);
+    uint8_t bucket         = 0;
+
+    if (NULL == entry)
+    {
+        rcosProfiler->missed++;
+        return;
+    }
+
+    while ((bucket < (CORE_PROFILER_BUCKETS - 1)) && (cycles >> (bucket + 1)))
+    {
+        bucket++;
+    }
+
+    entry->count++;
+    entry->total += cycles;
+    entry->min = MIN(entry->min, cycles);
+    entry->max = MAX(entry->max, cycles);
+    entry->histogram[bucket]++;
+}
+
+/// @brief  Run current event on a process, protothread events run the thread of their slot
+static void coreDispatch(tsProcess *process)
+{
+    tsThreadSlot *thread;
+    uint32_t result;
+    uint32_t cycles = 0;
+    uint32_t elapsed;
+    uint32_t start;
+    uint16_t budget;
+
+    if (rcosTrace)
+    {
+        traceRecord(rcosTrace->cycles(), eTraceBegin, eventCurrent.source, eventCurrent.destination, eventCurrent.event);
+    }
+
+    if (rcosProfiler)
+    {
+        cycles = rcosProfiler->cycles();
+    }
+
+    if (rcosDeadline && (0 == executorGroup))
+    {
+        rcosTick.disable();
+        dispatchStart   = timerTickCount;
+        dispatchWarned  = 0;
+        dispatchProcess = process;
+        rcosTick.enable();
+        start = dispatchStart;
+    }
+    else
+    {
+        start = timerTickCount; // Deadline warnings inside rcosTickIsr follow coreRun only and need rcosDeadline
+    }
+
+    if ((eventCurrent.source == eventCurrent.destination) && (EVENT_PT == eventCurrent.event))
+    {
+        thread = (EVENT_SLOT(eventCurrent.flags) < process->threadCount) ? &process->threads[EVENT_SLOT(eventCurrent.flags)] : NULL;
+        if (thread && thread->threadFunction)
+        {
+            thread->woken = 0;
+            result        = thread->threadFunction(process, &thread->thread);
+            if (PT_ENDED == result)
+            {
+                thread->threadFunction = NULL;
+            }
+            else if ((PT_YIELDED == result) && (NULL == rcosSimulation))
+            {
+                eventPostRaw(process->enumeration, process->enumeration, EVENT_PT, NULL, 0, TRUE, thread->tlc.post.flags);
+            }
+            else
+            {
+                // Yields wait a tick in simulation, threads that keep yielding would stop virtual time otherwise
+                globalIntDisable();
+                timerWheelStart(&timerEventWheel, (tsTimerHeading *)&thread->tlc, thread->woken ? 1 : result, thread->tlc.slack); // Wake is not lost
+                globalIntEnable();
+            }
+        }
+    }
+    else if (process->handlerCurrent)
+    {
+        process->handlerCurrent(process);
+    }
+
+    if (rcosDeadline && (0 == executorGroup))
+    {
+        rcosTick.disable();
+        elapsed         = timerTickCount - start;
+        dispatchProcess = NULL;
+        rcosTick.enable();
+    }
+    else
+    {
+        elapsed = timerTickCount - start;
+    }
+
+    if ((EVENT_PT != eventCurrent.event) && (process->timeMax < elapsed))
+    {
+        process->timeMax      = (uint16_t)elapsed;
+        process->timeMaxEvent = eventCurrent.event;
+    }
+
+    budget = deadlineBudget(process);
+    if (budget && (elapsed > budget))
+    {
+        deadlineOverrunRecord(process, elapsed);
+    }
+
+    if (rcosProfiler)
+    {
+        cycles = rcosProfiler->cycles() - cycles;
+        globalIntDisable(); // Executor threads share the table
+        profilerRecord(process->enumeration, eventCurrent.event, cycles);
+        globalIntEnable();
+    }
+
+    if (rcosTrace)
+    {
+        traceRecord(rcosTrace->cycles(), eTraceEnd, eventCurrent.source, eventCurrent.destination, eventCurrent.event);
+    }
+}
+
+/// @brief  Run current topic record on every subscriber of its topic
+static void topicDispatch(void)
+{
+    tsProcess *process;
+    tsTopic *topic;
+    uint8_t idx;
+
+    eventCurrent.length = (uint8_t)(eventCurrent.length - sizeof(topic));
+    memcpy(&topic, &eventData[eventCurrent.length], sizeof(topic));
+
+    for (idx = 0; idx < topic->count; idx++)
+    {
+        process = processFind(topic->subscribers[idx]);
+        if ((NULL == process) || (NULL == process->handlerCurrent))
+        {
+            continue; // Not started or stopped
+        }
+        if (process->group != executorGroup)
+        {
+            // Handlers of other executor groups run on their own thread, they get a copy of the record
+            eventBufRetain(eventBuf);
+            if (EXIT_SUCCESS != eventPostRaw(eventCurrent.source, process->enumeration, eventCurrent.event, eventData, eventCurrent.length, TRUE, (uint8_t)(eventCurrent.flags & ~EVENT_FLAG_TOPIC)))
+            {
+                eventBufRelease(eventBuf);
+            }
+            continue;
+        }
+        eventCurrent.destination = process->enumeration;
+        coreDispatch(process);
+    }
+}
+
+/// @brief  No handler runs until next event, posts and topic records made meanwhile have no source or publisher
+static void eventCurrentClear(void)
+{
+    eventCurrent.source      = PROCESS_NONE;
+    eventCurrent.destination = PROCESS_NONE;
+}
+
+/// @brief  Run event taken by eventPop on its destination and release it
+static void coreHandle(void)
+{
+    tsProcess *process;
+
+    if (eventCurrent.flags & EVENT_FLAG_TOPIC)
+    {
+        topicDispatch();
+        eventBufRelease(eventBuf);
+        eventBuf = NULL;
+        process = topicOwner(eventCurrent.source);
+        if (process)
+        {
+            globalIntDisable();
+            processUnload(process);
+            globalIntEnable();
+        }
+    }
+    else if (NULL == (process = processFind(eventCurrent.destination)))
+    {
+        eventBufRelease(eventBuf);
+    }
+    else
+    {
+        if (eventCurrent.event < PROCESS_COALESCE_MAX)
+        {
+            globalIntDisable();
+            process->coalescePending &= ~EVENT_MASK(eventCurrent.event); // Posts from now on are handled separately
+            globalIntEnable();
+        }
+
+        if (rcosExecutor)
+        {
+            rcosExecutor->groups[executorGroup].dispatched++;
+        }
+
+        coreDispatch(process);
+
+        eventBufRelease(eventBuf);
+        eventBuf = NULL;
+
+        globalIntDisable();
+        processUnload(process);
+        globalIntEnable();
+    }
+
+    eventCurrentClear();
+}
+
+/// @brief  Prepare queues and rings of executor groups
+static void executorInit(void)
+{
+    tsExecutorGroup *state;
+    uint32_t idx;
+    uint8_t group;
+
+    if (NULL == rcosExecutor)
+    {
+        return;
+    }
+
+    for (group = 0; group < rcosExecutor->count; group++)
+    {
+        state = &rcosExecutor->groups[group];
+        memset(state, 0, sizeof(*state));
+        state->queue.queue.buffer = &rcosExecutor->buffers[(uint32_t)group * rcosExecutor->queueSize];
+        state->queue.queue.size   = rcosExecutor->queueSize;
+        state->queue.group        = group;
+        state->ring               = &rcosExecutor->rings[(uint32_t)group * rcosExecutor->ringSize];
+        for (idx = 0; idx < rcosExecutor->ringSize; idx++)
+        {
+            state->ring[idx].sequence = idx;
+        }
+    }
+}
+
+/// @brief  Dispatch loop of an executor group other than 0, runs on its own thread
+static void executorRun(uint8_t group)
+{
+    executorGroup = group;
+    eventCurrentClear();
+
+    for (;;)
+    {
+        executorDrain(group);
+
+        globalIntDisable();
+        if (FALSE == eventPop())
+        {
+            if (TRUE == executorIdleBegin(group))
+            {
+                rcosExecutor->wait(group);
+            }
+            executorIdleEnd(group);
+            globalIntEnable();
+            continue;
+        }
+        globalIntEnable();
+
+        coreHandle();
+    }
+}
+
+/// @brief  Boot state of a boot table device, kept in system values of device
+static uint8_t *bootState(const tsBootDevice *entry)
+{
+    switch (entry->kind)
+    {
+    case eBootDevIo:
+        return &((const tsDevIo *)entry->device)->sys->boot;
+
+    case eBootDevCom:
+        return &((const tsDevCom *)entry->device)->sys->boot;
+
+    case eBootDevMem:
+        return &((const tsDevMem *)entry->device)->sys->boot;
+
+    default:
+        return &((const tsDevCpx *)entry->device)->sys->boot;
+    }
+}
+
+/// @brief  Find boot table entry of a device, NULL if device is not in boot table
+static tsBootDevice *bootDeviceFind(const void *device)
+{
+    uint16_t idx;
+
+    for (idx = 0; rcosBoot && (idx < rcosBoot->deviceCount); idx++)
+    {
+        if (rcosBoot->devices[idx].device == device)
+        {
+            return &rcosBoot->devices[idx];
+        }
+    }
+
+    return NULL;
+}
+
+/// @brief  Call init function of a boot table device once and record its duration
+static void bootStep(tsBootDevice *entry)
+{
+    const tsDevIo *io;
+    const tsDevCom *com;
+    const tsDevMem *mem;
+    const tsDevCpx *cpx;
+    uint8_t *state  = bootState(entry);
+    uint8_t result  = EXIT_SUCCESS; // Device without an init function is ready
+    uint32_t cycles = rcosBoot->cycles();
+
+    *state = eDevBootBusy; // Dev functions called by init do not start it again
+    switch (entry->kind)
+    {
+    case eBootDevIo:
+        io = entry->device;
+        if (io->functions && io->functions->init)
+        {
+            result = io->functions->init(io, entry->config);
+        }
+        break;
+
+    case eBootDevCom:
+        com = entry->device;
+        if (com->functions && com->functions->init)
+        {
+            result = com->functions->init(com);
+        }
+        break;
+
+    case eBootDevMem:
+        mem = entry->device;
+        if (mem->functions && mem->functions->init)
+        {
+            result = mem->functions->init(mem);
+        }
+        break;
+
+    default:
+        cpx = entry->device;
+        if (cpx->functions && cpx->functions->init)
+        {
+            result = cpx->functions->init(cpx, entry->config);
+        }
+        break;
+    }
+
+    entry->busy += rcosBoot->cycles() - cycles;
+    entry->calls++;
+
+    if (DEV_INIT_PENDING != result)
+    {
+        *state       = (EXIT_SUCCESS == result) ? eDevBootReady : eDevBootFailed;
+        entry->ready = rcosBoot->cycles() - rcosBoot->start;
+    }
+}
+
+/** @brief  Find next device waiting for boot process, devices take turns
+ *  @param  waiting Number of devices waiting for boot process
+ *  @return Boot table entry, NULL if no device is waiting
+ */
+static tsBootDevice *bootDeviceNext(uint16_t *waiting)
+{
+    static uint16_t cursor; ///< Position to start search for next device
+    tsBootDevice *next = NULL;
+    uint16_t position  = 0;
+    uint16_t idx;
+    uint8_t state;
+
+    *waiting = 0;
+    for (idx = 0; idx < rcosBoot->deviceCount; idx++)
+    {
+        position = (cursor + idx) % rcosBoot->deviceCount;
+        state    = *bootState(&rcosBoot->devices[position]);
+        if ((eDevBootPending == state) || (eDevBootBusy == state))
+        {
+            if (NULL == next)
+            {
+                next = &rcosBoot->devices[position];
+            }
+            (*waiting)++;
+        }
+    }
+
+    if (next)
+    {
+        cursor = (uint16_t)(next - rcosBoot->devices + 1);
+    }
+
+    return next;
+}
+
+/** @brief  Check devices that a boot table process depends on
+ *  @return eDevBootReady when process can be started, eDevBootFailed if one of the devices failed or eDevBootPending
+ */
+static uint8_t bootDepends(const tsBootProcess *entry)
+{
+    const tsBootDevice *device;
+    uint8_t result = eDevBootReady;
+    uint8_t state;
+    uint8_t idx;
+
+    for (idx = 0; idx < entry->dependCount; idx++)
+    {
+        device = entry->depends[idx] ? bootDeviceFind(entry->depends[idx]) : NULL;
+        if (NULL == device)
+        {
+            continue; // Devices that are not in boot table are initialized by their users
+        }
+
+        state = *bootState(device);
+        if (eDevBootFailed == state)
+        {
+            return eDevBootFailed;
+        }
+        if ((eDevBootPending == state) || (eDevBootBusy == state))
+        {
+            result = eDevBootPending;
+        }
+    }
+
+    return result;
+}
+
+/// @brief  Start boot table processes whose devices are initialized
+static void bootProcessRun(void)
+{
+    tsBootProcess *entry;
+    uint32_t cycles;
+    uint16_t idx;
+
+    for (idx = 0; idx < rcosBoot->processCount; idx++)
+    {
+        entry = &rcosBoot->processes[idx];
+        if (eDevBootPending != entry->state)
+        {
+            continue;
+        }
+
+        entry->state = bootDepends(entry);
+        if (eDevBootReady != entry->state)
+        {
+            continue;
+        }
+
+        cycles       = rcosBoot->cycles();
+        entry->start = cycles - rcosBoot->start;
+        if (EXIT_SUCCESS != processStart(entry->process))
+        {
+            entry->state = eDevBootFailed;
+        }
+        entry->busy = rcosBoot->cycles() - cycles;
+    }
+}
+
+/// @brief  Protothread of boot process, steps one device init and starts ready processes on each call
+static PT_THREAD(bootThread)
+{
+    static uint16_t stalls; ///< Init calls in a row that returned DEV_INIT_PENDING
+    tsBootDevice *entry;
+    uint16_t waiting;
+
+    PT_BEGIN();
+
+    for (;;)
+    {
+        entry = bootDeviceNext(&waiting);
+        if (entry)
+        {
+            bootStep(entry);
+            stalls = (eDevBootBusy == *bootState(entry)) ? (stalls + 1) : 0;
+        }
+        bootProcessRun();
+
+        if (NULL == entry)
+        {
+            break; // Processes still waiting have failed devices
+        }
+
+        if (stalls >= waiting)
+        {
+            stalls = 0;
+            PT_YIELD_TIMEOUT(CORE_BOOT_POLL); // Every device waits for its hardware
+        }
+        else
+        {
+            PT_YIELD();
+        }
+    }
+
+    rcosBoot->done = MAX(1u, rcosBoot->cycles() - rcosBoot->start);
+
+    PT_END();
+}
+
+/// @brief  Init function of boot process, it is not static as PROCESS_CREATE_RAW declares it
+PROCESS_INIT_PROTO(bootProcessInit)
+{
+    threadStart(process, bootThread);
+
+    process->initialized = 1;
+}
+
+/// @brief  Deinit function of boot process
+PROCESS_DEINIT_PROTO(bootProcessDeinit)
+{
+    threadStop(process, bootThread);
+
+    process->initialized = 0;
+}
+
+/// @brief  Hidden process that runs boot table
+PROCESS_CREATE_RAW(bootProcess, bootProcessInit, bootProcessDeinit, PROCESS_NONE, NULL, NULL, NULL, CORE_PRIORITY_DEFAULT, 0, 1, 0)
+
+/// @brief  Mark boot table devices and start boot process, called by coreRun after tick is started
+static void bootBegin(void)
+{
+    uint16_t idx;
+
+    if (NULL == rcosBoot)
+    {
+        return;
+    }
+
+    rcosBoot->start = rcosBoot->cycles();
+    for (idx = 0; idx < rcosBoot->deviceCount; idx++)
+    {
+        *bootState(&rcosBoot->devices[idx]) = rcosBoot->devices[idx].lazy ? eDevBootLazy : eDevBootPending;
+    }
+    for (idx = 0; idx < rcosBoot->processCount; idx++)
+    {
+        rcosBoot->processes[idx].state = eDevBootPending;
+    }
+
+    processStart(&bootProcess);
+}
+
+/// @brief  Paint stack and registered buffers, called by coreRun
+static void watermarkPaint(void)
+{
+    uint16_t idx;
+
+    if (NULL == rcosWatermark)
+    {
+        return;
+    }
+
+    if (rcosWatermark->stackPaint)
+    {
+        rcosWatermark->stackSize = rcosWatermark->stackPaint(&rcosWatermark->stack);
+    }
+    for (idx = 0; idx < rcosWatermark->count; idx++)
+    {
+        if (eWatermarkBuffer == rcosWatermark->areas[idx].kind)
+        {
+            memset(rcosWatermark->areas[idx].area, CORE_WATERMARK_PAINT, rcosWatermark->areas[idx].size);
+        }
+    }
+}
+
+/// @brief  Fill high-water mark of an event queue
+static void watermarkQueue(const tsEventQueue *queue, tProcessEnum process, tsWatermarkMark *mark)
+{
+    mark->name    = (PROCESS_NONE == process) ? "eventQueue" : "queue";
+    mark->kind    = eWatermarkQueue;
+    mark->process = process;
+    mark->size    = queue->queue.size;
+    mark->peak    = DEQUE_PEAK(&queue->queue);
+    mark->events  = queue->evCntMax;
+#if CORE_EVENTQUEUE_SIGNALS
+    mark->signals = queue->signalMax;
+#endif
+}
+
+/*********************************************************************
+ *  INTERFACES: FUNCTIONS
+ */
+
+/** @addtogroup DEBUGGING
+ *  @{
+ */
+
+int rcosDebugPrint(const char *format, ...)
+{
+    va_list args;
+    int length = 0;
+
+    if (rcosDebugDev && rcosDebugDev->sys->initialized)
+    {
+        va_start(args, format);
+        length = _devComVPrint(rcosDebugDev, format, args);
+        va_end(args);
+    }
+
+    return length;
+}
+
+/** @} */
+
+/** @addtogroup PROFILER
+ *  @{
+ */
+
+const tsProfilerEntry *profilerGet(tProcessEnum process, tEventEnum event)
+{
+    if (NULL == rcosProfiler)
+    {
+        return NULL;
+    }
+
+    return profilerEntry(process, event, FALSE);
+}
+
+void profilerReset(void)
+{
+    if (rcosProfiler)
+    {
+        memset(rcosProfiler->entries, 0, sizeof(tsProfilerEntry) * rcosProfiler->size);
+        rcosProfiler->missed = 0;
+    }
+}
+
+void profilerDump(int (*print)(const char *format, ...))
+{
+    const tsProfilerEntry *entry;
+    uint16_t idx;
+    uint8_t buckets;
+    uint8_t bucket;
+
+    if (NULL == rcosProfiler)
+    {
+        return;
+    }
+
+    jsonInit(print);
+    jsonObjOpen(NULL);
+    jsonNumber("frequency", rcosProfiler->frequency);
+    jsonNumber("missed", rcosProfiler->missed);
+    jsonArrOpen("entries");
+    for (idx = 0; idx < rcosProfiler->size; idx++)
+    {
+        entry = &rcosProfiler->entries[idx];
+        if (0 == entry->count)
+        {
+            continue;
+        }
+
+        buckets = CORE_PROFILER_BUCKETS;
+        while ((buckets > 1) && (0 == entry->histogram[buckets - 1]))
+        {
+            buckets--;
+        }
+
+        jsonObjOpen(NULL);
+        jsonNumber("process", entry->process);
+        jsonNumber("event", entry->event);
+        jsonNumber("count", entry->count);
+        jsonFloat("total", (float)entry->total, 0);
+        jsonNumber("min", entry->min);
+        jsonNumber("max", entry->max);
+        jsonArrOpen("histogram");
+        for (bucket = 0; bucket < buckets; bucket++)
+        {
+            jsonNumber(NULL, entry->histogram[bucket]);
+        }
+        jsonArrClose();
+        jsonObjClose();
+    }
+    jsonArrClose();
+    jsonObjClose();
+}
+
+/** @} */
+
+/** @addtogroup TRACE
+ *  @{
+ */
+
+void traceStart(void)
+{
+    if (NULL == rcosTrace)
+    {
+        return;
+    }
+
+    globalIntDisable();
+    rcosTrace->head   = 0;
+    rcosTrace->tail   = 0;
+    rcosTrace->count  = 0;
+    rcosTrace->offset = 0;
+    rcosTrace->lost   = 0;
+    rcosTrace->active = 1;
+    traceRecordRaw(rcosTrace->frequency, eTraceSync, 'R', 'T', CORE_TRACE_VERSION);
+    globalIntEnable();
+}
+
+void traceStop(void)
+{
+    if (rcosTrace)
+    {
+        rcosTrace->active = 0;
+    }
+}
+
+uint16_t traceDrain(const tsDevCom *device)
+{
+    uint16_t total = 0;
+    uint16_t length;
+    uint16_t sent;
+    uint32_t records;
+    uint8_t pass;
+
+    if (NULL == rcosTrace)
+    {
+        return 0;
+    }
+
+    for (pass = 0; pass < 2; pass++) // Records up to the end of ring first, then the ones from the beginning
+    {
+        globalIntDisable();
+        records = MIN(rcosTrace->count, (uint32_t)rcosTrace->size - rcosTrace->tail);
+        length  = (uint16_t)(MIN(records * sizeof(tsTraceRecord), 0x7FF8ul) - rcosTrace->offset);
+        globalIntEnable();
+
+        if (0 == length)
+        {
+            break;
+        }
+
+        // Writers never touch waiting records, they can be sent with interrupts enabled
+        sent = devComSend(device, (const uint8_t *)&rcosTrace->records[rcosTrace->tail] + rcosTrace->offset, length);
+        total += sent;
+
+        globalIntDisable();
+        records           = (rcosTrace->offset + sent) / sizeof(tsTraceRecord);
+        rcosTrace->offset = (uint8_t)((rcosTrace->offset + sent) % sizeof(tsTraceRecord));
+        rcosTrace->tail   = (uint16_t)((rcosTrace->tail + records) % rcosTrace->size);
+        rcosTrace->count  = (uint16_t)(rcosTrace->count - records);
+        globalIntEnable();
+
+        if (sent < length)
+        {
+            break; // Device cannot take more
+        }
+    }
+
+    globalIntDisable();
+    if (rcosTrace->lost && (rcosTrace->count < rcosTrace->size))
+    {
+        traceLost(rcosTrace->cycles()); // Report the loss without waiting for the next record
+    }
+    globalIntEnable();
+
+    return total;
+}
+
+/** @} */
+
+/** @addtogroup RECORD
+ *  @{
+ */
+
+uint8_t recordDevice(const void *device)
+{
+    if ((NULL == rcosRecorder) || (NULL == device) || (rcosRecorder->deviceCount >= MIN(rcosRecorder->deviceMax, 32u)))
+    {
+        return EXIT_FAILURE;
+    }
+
+    if (RECORD_DEVICE_NONE == recordDeviceIndex(device))
+    {
+        rcosRecorder->devices[rcosRecorder->deviceCount++] = device;
+    }
+
+    return EXIT_SUCCESS;
+}
+
+uint8_t recordStart(const tsDevMem *mem, uint32_t address, uint32_t length)
+{
+    if (NULL == rcosRecorder)
+    {
+        return EXIT_FAILURE;
+    }
+
+    globalIntDisable();
+    rcosRecorder->mem       = mem;
+    rcosRecorder->address   = address;
+    rcosRecorder->length    = length;
+    rcosRecorder->offset    = 0;
+    rcosRecorder->head      = 0;
+    rcosRecorder->count     = 0;
+    rcosRecorder->lost      = 0;
+    rcosRecorder->known     = 0;
+    rcosRecorder->nextReady = 0;
+    rcosRecorder->start     = timerTickCount;
+    rcosRecorder->mode      = eRecordOn;
+    globalIntEnable();
+
+    return EXIT_SUCCESS;
+}
+
+uint8_t replayStart(const tsDevMem *mem, uint32_t address, uint32_t length)
+{
+    if (NULL == rcosRecorder)
+    {
+        return EXIT_FAILURE;
+    }
+
+    globalIntDisable();
+    rcosRecorder->mem     = mem;
+    rcosRecorder->address = address;
+    rcosRecorder->length  = length;
+    rcosRecorder->offset  = 0;
+    rcosRecorder->known   = 0;
+    rcosRecorder->start   = timerTickCount;
+    rcosRecorder->mode    = eRecordReplay;
+    globalIntEnable();
+
+    replayLoad();
+
+    return EXIT_SUCCESS;
+}
+
+void recordStop(void)
+{
+    if (rcosRecorder)
+    {
+        rcosRecorder->mode = eRecordOff;
+    }
+}
+
+uint16_t recordDrain(void)
+{
+    uint16_t total = 0;
+    uint16_t length;
+    uint16_t tail;
+    uint8_t pass;
+
+    if ((NULL == rcosRecorder) || (NULL == rcosRecorder->mem))
+    {
+        return 0;
+    }
+
+    for (pass = 0; pass < 2; pass++) // Bytes up to the end of ring first, then the ones from the beginning
+    {
+        globalIntDisable();
+        tail   = (uint16_t)((rcosRecorder->head + rcosRecorder->size - rcosRecorder->count) % rcosRecorder->size);
+        length = (uint16_t)MIN(rcosRecorder->count, (uint32_t)rcosRecorder->size - tail);
+        length = (uint16_t)MIN(length, rcosRecorder->length - rcosRecorder->offset);
+        globalIntEnable();
+
+        if (0 == length)
+        {
+            break;
+        }
+
+        // Writers never touch waiting bytes, they can be written with interrupts enabled
+        if (EXIT_SUCCESS != devMemWrite(rcosRecorder->mem, rcosRecorder->address + rcosRecorder->offset, &rcosRecorder->ring[tail], length))
+        {
+            break; // Device cannot take them now, they are tried again on next drain
+        }
+        total = (uint16_t)(total + length);
+
+        globalIntDisable();
+        rcosRecorder->offset += length;
+        rcosRecorder->count = (uint16_t)(rcosRecorder->count - length);
+        globalIntEnable();
+    }
+
+    if (rcosRecorder->count && (rcosRecorder->offset == rcosRecorder->length))
+    {
+        recordStop(); // Storage is full, a partial record at its end is ignored by replay
+    }
+
+    return total;
+}
+
+teBool replayInput(teRecordKind kind, const void *device, void *data, uint16_t *length)
+{
+    tsRecorder *recorder = rcosRecorder;
+    uint16_t given       = 0;
+    uint8_t id;
+
+    if ((NULL == recorder) || (eRecordReplay != recorder->mode))
+    {
+        return FALSE;
+    }
+
+    id = recordDeviceIndex(device);
+    if (RECORD_DEVICE_NONE == id)
+    {
+        return FALSE;
+    }
+
+    replayFeed(); // Records of the same tick that came before this input
+
+    if (eRecordIoGet == kind)
+    {
+        if (0 == (recorder->known & (1ul << id)))
+        {
+            return FALSE; // Nothing replayed yet, live value is used
+        }
+        given = (uint16_t)MIN(*length, sizeof(recorder->values[id]));
+        memcpy(data, &recorder->values[id], given);
+        *length = given;
+        return TRUE;
+    }
+
+    if ((TRUE == replayDue()) && (eRecordComReceive == recorder->next.kind) && (id == recorder->next.id))
+    {
+        given = (uint16_t)(recorder->next.length - recorder->nextTaken);
+        if (*length)
+        {
+            given = MIN(given, *length);
+            memcpy(data, &recorder->nextData[recorder->nextTaken], given);
+            recorder->nextTaken = (uint8_t)(recorder->nextTaken + given);
+            if (recorder->nextTaken == recorder->next.length)
+            {
+                replayLoad(); // Data of the same tick can be taken by the next call
+            }
+        }
+    }
+    *length = given;
+
+    return TRUE;
+}
+
+void recordInput(teRecordKind kind, const void *device, const void *data, uint16_t length)
+{
+    tsRecorder *recorder = rcosRecorder;
+    const uint8_t *bytes = data;
+    uint32_t value       = 0;
+    uint8_t little[sizeof(value)];
+    uint8_t chunk;
+    uint8_t id;
+
+    if ((NULL == recorder) || (eRecordOn != recorder->mode) || (0 == length))
+    {
+        return;
+    }
+
+    id = recordDeviceIndex(device);
+    if (RECORD_DEVICE_NONE == id)
+    {
+        return;
+    }
+
+    if (eRecordIoGet == kind)
+    {
+        memcpy(&value, data, MIN(length, sizeof(value)));
+        if ((recorder->known & (1ul << id)) && (recorder->values[id] == value))
+        {
+            return; // Only changes are recorded
+        }
+        recorder->values[id] = value;
+        recorder->known |= 1ul << id;
+
+        little[0] = (uint8_t)value;
+        little[1] = (uint8_t)(value >> 8);
+        little[2] = (uint8_t)(value >> 16);
+        little[3] = (uint8_t)(value >> 24);
+        recordPut(kind, id, 0, little, sizeof(little));
+        return;
+    }
+
+    while (length)
+    {
+        chunk = (uint8_t)MIN(length, 0xFFu);
+        recordPut(kind, id, 0, bytes, chunk);
+        bytes += chunk;
+        length = (uint16_t)(length - chunk);
+    }
+}
+
+/** @} */
+
+/** @addtogroup EXECUTOR
+ *  @{
+ */
+
+uint8_t processAffinity(tsProcess *process, uint8_t group)
+{
+    if (process->initialized || (group && ((NULL == rcosExecutor) || (group >= rcosExecutor->count))))
+    {
+        return EXIT_FAILURE;
+    }
+
+    process->group = group;
+    if (process->queue)
+    {
+        process->queue->group = group;
+    }
+
+    return EXIT_SUCCESS;
+}
+
+/** @} */
+
+/** @addtogroup BOOT
+ *  @{
+ */
+
+uint8_t bootDevice(const void *device)
+{
+    tsBootDevice *entry = bootDeviceFind(device);
+    uint16_t tries;
+    uint8_t *state;
+
+    if (NULL == entry)
+    {
+        return EXIT_FAILURE;
+    }
+
+    state = bootState(entry);
+    if (eDevBootBusy == *state)
+    {
+        return DEV_INIT_PENDING; // Called from its own init, or boot process finishes it
+    }
+
+    for (tries = 0; (eDevBootLazy == *state) || (eDevBootPending == *state) || (eDevBootBusy == *state); tries++)
+    {
+        if (tries >= CORE_BOOT_TRIES)
+        {
+            *state       = eDevBootFailed; // Hardware does not answer, callers must not wait forever
+            entry->ready = rcosBoot->cycles() - rcosBoot->start;
+            break;
+        }
+        bootStep(entry);
+    }
+
+    return (eDevBootReady == *state) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+void bootDump(int (*print)(const char *format, ...))
+{
+    const tsBootDevice *device;
+    const tsBootProcess *entry;
+    uint16_t idx;
+
+    if (NULL == rcosBoot)
+    {
+        return;
+    }
+
+    jsonInit(print);
+    jsonObjOpen(NULL);
+    jsonNumber("frequency", rcosBoot->frequency);
+    jsonNumber("done", rcosBoot->done);
+    jsonArrOpen("devices");
+    for (idx = 0; idx < rcosBoot->deviceCount; idx++)
+    {
+        device = &rcosBoot->devices[idx];
+        jsonObjOpen(NULL);
+        jsonNumber("index", idx);
+        jsonNumber("kind", device->kind);
+        jsonNumber("state", *bootState(device));
+        jsonNumber("calls", device->calls);
+        jsonNumber("busy", device->busy);
+        jsonNumber("ready", device->ready);
+        jsonObjClose();
+    }
+    jsonArrClose();
+    jsonArrOpen("processes");
+    for (idx = 0; idx < rcosBoot->processCount; idx++)
+    {
+        entry = &rcosBoot->processes[idx];
+        jsonObjOpen(NULL);
+        jsonNumber("process", entry->process->enumeration);
+        jsonNumber("state", entry->state);
+        jsonNumber("start", entry->start);
+        jsonNumber("busy", entry->busy);
+        jsonObjClose();
+    }
+    jsonArrClose();
+    jsonObjClose();
+}
+
+/** @} */
+
+/** @addtogroup WATERMARK
+ *  @{
+ */
+
+uint8_t watermarkGet(uint16_t idx, tsWatermarkMark *mark)
+{
+    const tsWatermarkArea *area;
+    const tsProcess *process;
+    const uint8_t *bytes;
+    uint32_t offset;
+
+    memset(mark, 0, sizeof(*mark));
+    mark->process = PROCESS_NONE;
+
+    if (rcosWatermark)
+    {
+        if (0 == idx)
+        {
+            // Deepest frame is the first byte that is not paint from the bottom
+            for (offset = 0; (offset < rcosWatermark->stackSize) && (CORE_WATERMARK_PAINT == rcosWatermark->stack[offset]); offset++)
+            {
+            }
+            mark->name = "stack";
+            mark->kind = eWatermarkStack;
+            mark->size = rcosWatermark->stackSize;
+            mark->peak = rcosWatermark->stackSize - offset;
+            return EXIT_SUCCESS;
+        }
+        idx--;
+    }
+
+    if (0 == idx)
+    {
+        watermarkQueue(&eventQueue, PROCESS_NONE, mark);
+        return EXIT_SUCCESS;
+    }
+    idx--;
+
+    for (process = processNext(NULL); process; process = processNext(process))
+    {
+        if (NULL == process->queue)
+        {
+            continue;
+        }
+        if (0 == idx)
+        {
+            watermarkQueue(process->queue, process->enumeration, mark);
+            return EXIT_SUCCESS;
+        }
+        idx--;
+    }
+
+    if ((NULL == rcosWatermark) || (idx >= rcosWatermark->count))
+    {
+        return EXIT_FAILURE;
+    }
+
+    area       = &rcosWatermark->areas[idx];
+    mark->name = area->name;
+    mark->kind = area->kind;
+    if (eWatermarkDeque == area->kind)
+    {
+        mark->size = ((const tsDeque *)area->area)->size;
+        mark->peak = DEQUE_PEAK((const tsDeque *)area->area);
+    }
+    else
+    {
+        bytes = area->area;
+        for (offset = area->size; offset && (CORE_WATERMARK_PAINT == bytes[offset - 1]); offset--)
+        {
+        }
+        mark->size = area->size;
+        mark->peak = offset;
+    }
+
+    return EXIT_SUCCESS;
+}
+
+void watermarkDump(int (*print)(const char *format, ...))
+{
+    tsWatermarkMark mark;
+    uint16_t idx;
+
+    jsonInit(print);
+    jsonArrOpen(NULL);
+    for (idx = 0; EXIT_SUCCESS == watermarkGet(idx, &mark); idx++)
+    {
+        jsonObjOpen(NULL);
+        jsonString("name", mark.name);
+        jsonNumber("kind", mark.kind);
+        jsonNumber("size", mark.size);
+        jsonNumber("peak", mark.peak);
+        if (eWatermarkQueue == mark.kind)
+        {
+            jsonNumber("process", mark.process);
+            jsonNumber("events", mark.events);
+            jsonNumber("signals", mark.signals);
+        }
+        jsonObjClose();
+    }
+    jsonArrClose();
+}
+
+/** @} */
+
+/** @addtogroup EVENTS
+ *  @{
+ */
+
+teBool eventCongested(tProcessEnum destination)
+{
+    tsProcess *process = processFind(destination);
+
+    return (process && process->quota && process->quota->congested) ? TRUE : FALSE;
+}
+
+uint8_t eventPost(tProcessEnum destination, tEventEnum event, const void *data, uint8_t length)
+{
+    if (TRUE == isIsrActive())
+    {
+        return EXIT_FAILURE;
+    }
+
+    return EVENT_POST_RESULT(eventPostRaw(eventCurrent.destination, destination, event, data, length, TRUE, 0));
+}
+
+uint8_t eventPostPone(void)
+{
+    if ((TRUE == isIsrActive()) || (EVENT_PT == eventCurrent.event))
+    {
+        return EXIT_FAILURE;
+    }
+
+    if (eventBuf)
+    {
+        eventBufRetain(eventBuf); // Reference of current event is released after handler returns
+        if (EXIT_SUCCESS != eventPostRaw(eventCurrent.source, eventCurrent.destination, eventCurrent.event, eventData, eventCurrent.length, TRUE, EVENT_FLAG_REF))
+        {
+            eventBufRelease(eventBuf);
+            return EXIT_FAILURE;
+        }
+        return EXIT_SUCCESS;
+    }
+
+    return EVENT_POST_RESULT(eventPostRaw(eventCurrent.source, eventCurrent.destination, eventCurrent.event, eventData, eventCurrent.length, TRUE, 0));
+}
+
+uint8_t eventPostInIsr(tProcessEnum destination, tEventEnum event)
+{
+    if (FALSE == isIsrActive())
+    {
+        return EXIT_FAILURE;
+    }
+    if (TRUE == recordIsr(eRecordIsrPostFront, destination, event, NULL, 0))
+    {
+        return EXIT_SUCCESS; // Replayed inputs take its place
+    }
+
+    return EVENT_POST_RESULT(eventPostRaw(destination, destination, event, NULL, 0, FALSE, 0));
+}
+
+void *eventBufAlloc(uint16_t size)
+{
+    tsEventBuf *heading = NULL;
+
+    if (rcosEventBufPool && (sizeof(tsEventBuf) + size <= rcosEventBufPool->blockSize))
+    {
+        globalIntDisable();
+        heading = poolAlloc(rcosEventBufPool);
+        globalIntEnable();
+    }
+
+    if (NULL == heading)
+    {
+        return NULL;
+    }
+
+    heading->refs   = 1;
+    heading->length = size;
+
+    return heading + 1;
+}
+
+void eventBufRetain(void *buf)
+{
+    if (NULL == buf)
+    {
+        return;
+    }
+
+    globalIntDisable();
+    EVENT_BUF_HEADING(buf)->refs++;
+    globalIntEnable();
+}
+
+void eventBufRelease(void *buf)
+{
+    tsEventBuf *heading;
+
+    if (NULL == buf)
+    {
+        return;
+    }
+
+    heading = EVENT_BUF_HEADING(buf);
+
+    globalIntDisable();
+    if (heading->refs && (0 == --heading->refs))
+    {
+        poolFree(rcosEventBufPool, heading);
+    }
+    globalIntEnable();
+}
+
+uint8_t eventPostRef(tProcessEnum destination, tEventEnum event, void *buf, uint16_t length)
+{
+    if (NULL == buf)
+    {
+        return EXIT_FAILURE;
+    }
+
+    if ((TRUE == isIsrActive()) || (sizeof(tsEventBuf) + length > rcosEventBufPool->blockSize))
+    {
+        eventBufRelease(buf);
+        return EXIT_FAILURE;
+    }
+
+    EVENT_BUF_HEADING(buf)->length = length;
+
+    if (EXIT_SUCCESS != eventPostRaw(eventCurrent.destination, destination, event, &buf, sizeof(buf), TRUE, EVENT_FLAG_REF))
+    {
+        eventBufRelease(buf);
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
+
+uint8_t eventPostFromIsr(tProcessEnum destination, tEventEnum event, const void *data, uint8_t length)
+{
+    return isrRingPost(destination, event, data, length, 0);
+}
+
+uint8_t eventReply(tEventEnum event, const void *data, uint8_t length)
+{
+    if ((TRUE == isIsrActive()) || (EVENT_PT == eventCurrent.event) || (PROCESS_NONE == eventCurrent.source))
+    {
+        return EXIT_FAILURE;
+    }
+
+    return EVENT_POST_RESULT(eventPostRaw(eventCurrent.destination, eventCurrent.source, event, data, length, TRUE, 0));
+}
+
+/** @} */
+
+/** @addtogroup TOPICS
+ *  @{
+ */
+
+uint8_t topicSubscribe(tsTopic *topic, tProcessEnum process)
+{
+    uint8_t idx;
+
+    for (idx = 0; idx < topic->count; idx++)
+    {
+        if (topic->subscribers[idx] == process)
+        {
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (topic->count >= topic->size)
+    {
+        return EXIT_FAILURE;
+    }
+
+    topic->subscribers[topic->count++] = process;
+
+    return EXIT_SUCCESS;
+}
+
+uint8_t topicUnsubscribe(tsTopic *topic, tProcessEnum process)
+{
+    uint8_t idx;
+
+    for (idx = 0; idx < topic->count; idx++)
+    {
+        if (topic->subscribers[idx] == process)
+        {
+            topic->count--;
+            memmove(&topic->subscribers[idx], &topic->subscribers[idx + 1], (topic->count - idx) * sizeof(tProcessEnum));
+            return EXIT_SUCCESS;
+        }
+    }
+
+    return EXIT_FAILURE;
+}
+
+uint8_t topicPublish(tsTopic *topic, const void *data, uint8_t length)
+{
+    if ((TRUE == isIsrActive()) || ((uint32_t)length + sizeof(topic) > UINT8_MAX))
+    {
+        return EXIT_FAILURE;
+    }
+
+    return EVENT_POST_RESULT(topicPost(topic, data, length, 0));
+}
+
+uint8_t topicPublishRef(tsTopic *topic, void *buf, uint16_t length)
+{
+    if (NULL == buf)
+    {
+        return EXIT_FAILURE;
+    }
+
+    if ((TRUE == isIsrActive()) || (sizeof(tsEventBuf) + length > rcosEventBufPool->blockSize))
+    {
+        eventBufRelease(buf);
+        return EXIT_FAILURE;
+    }
+
+    EVENT_BUF_HEADING(buf)->length = length;
+
+    if (EXIT_SUCCESS != topicPost(topic, &buf, sizeof(buf), EVENT_FLAG_REF))
+    {
+        eventBufRelease(buf);
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
+
+/** @} */
+
+/** @addtogroup TIMERS
+ *  @{
+ */
+
+CORE_TICK_PROTO(rcosTickIsr)
+{
+    timerTick();
+}
+
+void rcosTickIsrElapsed(uint32_t ticks)
+{
+    uint32_t skip;
+
+    if (0 == (timerGenericWheel.count + timerCallBackWheel.count + timerEventWheel.count))
+    {
+        timerTickCount += ticks; // Nothing to expire or cascade
+        if (rcosDeadline && dispatchProcess && (0 == dispatchWarned))
+        {
+            deadlineWarn();
+        }
+        return;
+    }
+
+    while (ticks)
+    {
+        // Ticks before the next expiry or first level wrap have nothing to do
+        skip = (ticks > 1) ? (MIN(ticks, timerTickNext()) - 1) : 0;
+        timerTickCount += skip;
+        ticks -= skip + 1;
+        timerTick();
+    }
+}
+
+CORE_TICK_PROTO(rcosSimulationTick)
+{
+}
+
+void rcosSimulationProgram(uint32_t ticks)
+{
+    static uint8_t ended; // Simulation goes on without a limit after end has returned
+    uint32_t left;
+
+    ticks = MIN(ticks, timerWheelNext(&timerGenericWheel)); // Generic timers are polled, time must stop for them too
+
+    if (ended)
+    {
+        if (CORE_TIMER_PERIOD_MAX != ticks)
+        {
+            rcosTickIsrElapsed(ticks);
+        }
+        return; // Only other interrupts can post events when no timer is armed
+    }
+
+    left = (rcosSimulation && rcosSimulation->limit) ? (rcosSimulation->limit - timerTickCount) : CORE_TIMER_PERIOD_MAX;
+    if (ticks < left)
+    {
+        rcosTickIsrElapsed(ticks);
+        return;
+    }
+
+    if (CORE_TIMER_PERIOD_MAX != left)
+    {
+        rcosTickIsrElapsed(left);
+    }
+    ended = 1;
+
+    if (rcosSimulation && rcosSimulation->end)
+    {
+        rcosSimulation->end();
+    }
+}
+
+uint32_t rcosTickCount(void)
+{
+    return timerTickCount;
+}
+
+uint8_t timerGenericStart(tsTimerGeneric *obj, uint32_t period)
+{
+    globalIntDisable();
+    timerWheelStart(&timerGenericWheel, (tsTimerHeading *)obj, period, 0);
+    globalIntEnable();
+
+    return EXIT_SUCCESS;
+}
+
+uint8_t timerGenericStop(tsTimerGeneric *obj)
+{
+    globalIntDisable();
+    timerWheelRemove(&timerGenericWheel, (tsTimerHeading *)obj);
+    obj->_cnt = 0;
+    globalIntEnable();
+
+    return EXIT_SUCCESS;
+}
+
+uint8_t timerCallBackStart(tsTimerCallBack *obj, uint32_t period)
+{
+    if (NULL == obj->callBack)
+    {
+        coreSysReset(CORE_RESET_CALLBACK_NULL, (uint32_t)(uintptr_t)obj);
+    }
+
+    globalIntDisable();
+    if (obj->_pending)
+    {
+        ldlDelete(&timerDeferred, obj);
+        obj->_pending = 0;
+    }
+    timerWheelStart(&timerCallBackWheel, (tsTimerHeading *)obj, period, obj->slack);
+    globalIntEnable();
+
+    return EXIT_SUCCESS;
+}
+
+uint8_t timerCallBackStop(tsTimerCallBack *obj)
+{
+    globalIntDisable();
+    if (obj->_pending)
+    {
+        ldlDelete(&timerDeferred, obj);
+        obj->_pending = 0;
+    }
+    timerWheelRemove(&timerCallBackWheel, (tsTimerHeading *)obj);
+    obj->_cnt = 0;
+    globalIntEnable();
+
+    return EXIT_SUCCESS;
+}
+
+uint8_t timerCallBackStartSlack(tsTimerCallBack *obj, uint32_t period, uint16_t slack)
+{
+    obj->slack = slack;
+
+    return timerCallBackStart(obj, period);
+}
+
+uint8_t timerEventStart(tsTimerEvent *obj, uint32_t duration)
+{
+    if (PROCESS_NONE == obj->post.destination)
+    {
+        return EXIT_FAILURE;
+    }
+
+    globalIntDisable();
+    timerWheelStart(&timerEventWheel, (tsTimerHeading *)obj, duration, obj->slack);
+    globalIntEnable();
+
+    return EXIT_SUCCESS;
+}
+
+uint8_t timerEventStop(tsTimerEvent *obj)
+{
+    globalIntDisable();
+    timerWheelRemove(&timerEventWheel, (tsTimerHeading *)obj);
+    obj->_cnt = 0;
+    globalIntEnable();
+
+    return EXIT_SUCCESS;
+}
+
+uint8_t timerEventStartSlack(tsTimerEvent *obj, uint32_t duration, uint16_t slack)
+{
+    obj->slack = slack;
+
+    return timerEventStart(obj, duration);
+}
+
+/** @} */
+
+/** @addtogroup TIMER_POLL
+ *  @{
+ */
+
+TIMER_CALLBACK_FUNC(timerPollRun)
+{
+    tsTimerPollGroup *group = parameter;
+    tsTimerPollMember *member;
+    tsTimerPollMember *next;
+    uint32_t keep;
+
+    globalIntDisable();
+    member = (tsTimerPollMember *)group->members.head;
+    globalIntEnable();
+
+    while (member)
+    {
+        globalIntDisable();
+        next = (tsTimerPollMember *)member->_li.tail; // Member may leave inside its function
+        globalIntEnable();
+
+        keep = member->callBack(member->parameter);
+        if (0 == keep)
+        {
+            globalIntDisable();
+            ldlDelete(&group->members, member);
+            globalIntEnable();
+        }
+        member = next;
+    }
+
+    return group->members.count ? group->period : 0;
+}
+
+uint8_t timerPollJoin(tsTimerPollGroup *group, tsTimerPollMember *member)
+{
+    uint32_t count;
+
+    if (NULL == member->callBack)
+    {
+        return EXIT_FAILURE;
+    }
+
+    globalIntDisable();
+    count = group->members.count;
+    ldlInsertTail(&group->members, member);
+    if (count == group->members.count)
+    {
+        globalIntEnable();
+        return EXIT_FAILURE; // Already a member
+    }
+    globalIntEnable();
+
+    if (0 == count)
+    {
+        timerCallBackStart(&group->timer, group->period);
+    }
+
+    return EXIT_SUCCESS;
+}
+
+uint8_t timerPollLeave(tsTimerPollGroup *group, tsTimerPollMember *member)
+{
+    uint32_t count;
+
+    globalIntDisable();
+    count = group->members.count;
+    ldlDelete(&group->members, member);
+    if (count == group->members.count)
+    {
+        globalIntEnable();
+        return EXIT_FAILURE; // Not a member
+    }
+    globalIntEnable();
+
+    if (0 == group->members.count)
+    {
+        timerCallBackStop(&group->timer);
+    }
+
+    return EXIT_SUCCESS;
+}
+
+/** @} */
+
+/** @addtogroup TIMER_HR
+ *  @{
+ */
+
+CORE_TICK_PROTO(rcosHrTimerIsr)
+{
+    tsHrTimerCallBack *timer;
+    uint32_t period;
+
+    while (NULL != (timer = (tsHrTimerCallBack *)hrTimerQueue.head))
+    {
+        if ((int32_t)(timer->_deadline - rcosHrTimer->now()) > 0)
+        {
+            break;
+        }
+
+        ldlPopHead(&hrTimerQueue);
+        timer->_running = 0;
+        if (timer->deferred)
+        {
+            timer->_pending = 1;
+            ldlInsertTail(&hrTimerDeferred, timer);
+            continue;
+        }
+
+        if (rcosTrace)
+        {
+            traceRecord(rcosTrace->cycles(), eTraceCallBack, PROCESS_NONE, PROCESS_NONE, EVENT_NONE);
+        }
+        period = timer->callBack(timer->parameter);
+        if (period)
+        {
+            hrTimerRepeat(timer, period);
+        }
+    }
+    hrTimerProgram();
+}
+
+TIMER_CALLBACK_FUNC(hrTimerEventRun)
+{
+    tsHrTimerEvent *timerEvent = parameter;
+
+    if (rcosTrace)
+    {
+        traceRecord(rcosTrace->cycles(), eTraceTimer, timerEvent->post.source, timerEvent->post.destination, timerEvent->post.event);
+    }
+    if (FALSE == eventPostDone(eventPostRaw(timerEvent->post.source, timerEvent->post.destination, timerEvent->post.event, NULL, 0, TRUE, EVENT_FLAG_TRACED)))
+    {
+        return CORE_HRTIMER_RETRY;
+    }
+
+    return 0;
+}
+
+uint32_t hrTimerNow(void)
+{
+    return rcosHrTimer ? rcosHrTimer->now() : 0;
+}
+
+uint8_t hrTimerCallBackStart(tsHrTimerCallBack *obj, uint32_t period)
+{
+    if (NULL == rcosHrTimer)
+    {
+        return EXIT_FAILURE;
+    }
+
+    return hrTimerCallBackStartAt(obj, rcosHrTimer->now() + MIN(period, CORE_TIMER_PERIOD_MAX));
+}
+
+uint8_t hrTimerCallBackStartAt(tsHrTimerCallBack *obj, uint32_t deadline)
+{
+    if (NULL == rcosHrTimer)
+    {
+        return EXIT_FAILURE;
+    }
+    if (NULL == obj->callBack)
+    {
+        coreSysReset(CORE_RESET_CALLBACK_NULL, (uint32_t)(uintptr_t)obj);
+    }
+
+    globalIntDisable();
+    hrTimerRemove(obj);
+    hrTimerInsert(obj, deadline);
+    if (hrTimerQueue.head == &obj->_li)
+    {
+        hrTimerProgram();
+    }
+    globalIntEnable();
+
+    return EXIT_SUCCESS;
+}
+
+uint8_t hrTimerCallBackStop(tsHrTimerCallBack *obj)
+{
+    teBool head;
+
+    globalIntDisable();
+    head = (hrTimerQueue.head == &obj->_li) ? TRUE : FALSE;
+    hrTimerRemove(obj);
+    if (head && rcosHrTimer)
+    {
+        hrTimerProgram();
+    }
+    globalIntEnable();
+
+    return EXIT_SUCCESS;
+}
+
+uint8_t hrTimerEventStart(tsHrTimerEvent *obj, uint32_t duration)
+{
+    if (PROCESS_NONE == obj->post.destination)
+    {
+        return EXIT_FAILURE;
+    }
+
+    return hrTimerCallBackStart(&obj->timer, duration);
+}
+
+uint8_t hrTimerEventStop(tsHrTimerEvent *obj)
+{
+    return hrTimerCallBackStop(&obj->timer);
+}
+
+/** @} */
+
+/** @addtogroup PROTOTHREADS
+ *  @{
+ */
+
+uint8_t threadStart(tsProcess *process, PT_THREAD((*threadFunction)))
+{
+    return threadStartSlot(process, 0, threadFunction);
+}
+
+uint8_t threadStartSlot(tsProcess *process, uint8_t slot, PT_THREAD((*threadFunction)))
+{
+    tsThreadSlot *thread;
+
+    if ((NULL == threadFunction) || (slot >= process->threadCount) || (slot >= CORE_THREADS_MAX))
+    {
+        return EXIT_FAILURE;
+    }
+
+    thread = &process->threads[slot];
+    if (NULL != thread->threadFunction)
+    {
+        return EXIT_FAILURE;
+    }
+
+    timerEventStop(&thread->tlc); // Wake timer of a previous thread of this slot may still be running
+    thread->tlc.post.source      = process->enumeration;
+    thread->tlc.post.destination = process->enumeration;
+    thread->tlc.post.event       = EVENT_PT;
+    thread->tlc.post.length      = 0;
+    thread->tlc.post.flags       = EVENT_FLAG_SLOT(slot);
+    thread->thread.lc            = 0;
+    thread->thread.tgen          = 0;
+    thread->threadFunction       = threadFunction;
+
+    return eventPostRaw(process->enumeration, process->enumeration, EVENT_PT, NULL, 0, TRUE, EVENT_FLAG_SLOT(slot));
+}
+
+uint8_t threadStop(tsProcess *process, PT_THREAD((*threadFunction)))
+{
+    uint8_t slot;
+
+    for (slot = 0; (NULL != threadFunction) && (slot < process->threadCount); slot++)
+    {
+        if (process->threads[slot].threadFunction == threadFunction)
+        {
+            return threadStopSlot(process, slot);
+        }
+    }
+
+    return EXIT_FAILURE;
+}
+
+uint8_t threadStopSlot(tsProcess *process, uint8_t slot)
+{
+    if ((slot >= process->threadCount) || (NULL == process->threads[slot].threadFunction))
+    {
+        return EXIT_FAILURE;
+    }
+
+    process->threads[slot].thread.lc = 1; // Thread ends on its next call
+
+    return EXIT_SUCCESS;
+}
+
+uint8_t threadWake(tsProcess *process, uint8_t slot)
+{
+    if ((NULL == process) || (slot >= process->threadCount) || (NULL == process->threads[slot].threadFunction))
+    {
+        return EXIT_FAILURE;
+    }
+
+    globalIntDisable();
+    process->threads[slot].woken = 1; // Wait period returned by a running thread is ignored
+    timerWheelStart(&timerEventWheel, (tsTimerHeading *)&process->threads[slot].tlc, 1, 0); // Isrs cannot post EVENT_PT
+    globalIntEnable();
+
+    return EXIT_SUCCESS;
+}
+
+/** @} */
+
+/** @addtogroup WDT
+ *  @{
+ */
+
+const tsOverrun *deadlineOverrun(uint16_t idx)
+{
+    uint32_t kept;
+
+    if (NULL == rcosDeadline)
+    {
+        return NULL;
+    }
+
+    kept = MIN(rcosDeadline->count, rcosDeadline->size);
+    if (idx >= kept)
+    {
+        return NULL;
+    }
+
+    return &rcosDeadline->log[(rcosDeadline->head + rcosDeadline->size - 1u - idx) % rcosDeadline->size];
+}
+
+/** @} */
+
+/** @addtogroup PROCESS
+ *  @{
+ */
+
+uint8_t processStart(tsProcess *process)
+{
+    if (process->initialized)
+    {
+        return EXIT_FAILURE;
+    }
+
+    globalIntDisable();
+    if (PROCESS_NONE == process->enumeration)
+    {
+        process->enumeration = --processHiddenMin;
+    }
+    ldlInsertTail(&processList, process);
+    if (rcosProcessTable && (process->enumeration < rcosProcessTable->size) && (NULL == rcosProcessTable->entries[process->enumeration]))
+    {
+        rcosProcessTable->entries[process->enumeration] = process; // First one wins like the list search
+    }
+    globalIntEnable();
+
+    if (process->init)
+    {
+        process->init(process);
+    }
+
+    return EXIT_SUCCESS;
+}
+
+uint8_t processStop(tsProcess *process)
+{
+    if (!process->initialized)
+    {
+        return EXIT_FAILURE;
+    }
+
+    globalIntDisable();
+    if (process->deinit)
+    {
+        process->deinit(process);
+    }
+    globalIntEnable();
+
+    return EXIT_SUCCESS;
+}
+
+tsProcess *processFind(tProcessEnum enumeration)
+{
+    tsProcess *process;
+
+    if (rcosProcessTable && (enumeration < rcosProcessTable->size))
+    {
+        return rcosProcessTable->entries[enumeration];
+    }
+
+    LIST_DL_FOREACH(process, &processList)
+    {
+        if (process->enumeration == enumeration)
+        {
+            return process;
+        }
+    }
+
+    return NULL;
+}
+
+tsProcess *processNext(const tsProcess *process)
+{
+    return (tsProcess *)(process ? process->_li.tail : processList.head);
+}
+
+/** @} */
+
+/** @addtogroup CORE
+ *  @{
+ */
+
+void coreInit(void)
+{
+    uint32_t idx;
+
+    ADD_RCOS_VERSION("core", "2.0.1")
+
+    rcosWdt.refresh();
+    rcosWdt.stop();
+    dequeFlush(&eventQueue.queue);
+    for (idx = 0; idx < CORE_ISR_RING_SIZE; idx++)
+    {
+        isrRing[idx].sequence = idx;
+    }
+    executorInit();
+    eventCurrentClear();
+    devComInit(rcosDebugDev);
+    traceStart();
+}
+
+void coreRun(void)
+{
+    uint8_t group;
+
+    rcosWdt.start();
+    rcosTick.start();
+    if (rcosHrTimer)
+    {
+        rcosHrTimer->start();
+    }
+    watermarkPaint();
+    bootBegin();
+
+    for (group = 1; rcosExecutor && (group < rcosExecutor->count); group++)
+    {
+        rcosExecutor->spawn(executorRun, group);
+    }
+
+    for (;;)
+    {
+        if (0 == (rcosWdtVars.flagMask & ~rcosWdtVars.flags))
+        {
+            rcosWdt.refresh();
+            rcosWdtVars.flags = 0;
+        }
+
+        isrRingDrain();
+        executorDrain(0);
+        replayFeed();
+        timerDeferredRun();
+        hrTimerDeferredRun();
+
+        if (rcosDegraded && (rcosDegraded->notified != rcosDegraded->active))
+        {
+            rcosDegraded->notified = rcosDegraded->active;
+            rcosDegraded->hook((teBool)rcosDegraded->notified);
+        }
+
+        globalIntDisable();
+        if (FALSE == eventPop())
+        {
+            if (rcosTick.program && (FALSE == isrRingPending()) && (0 == timerDeferred.count) && (0 == hrTimerDeferred.count) && (TRUE == executorIdleBegin(0)))
+            {
+                if (rcosTrace)
+                {
+                    traceRecordRaw(rcosTrace->cycles(), eTraceIdle, PROCESS_NONE, PROCESS_NONE, EVENT_NONE);
+                }
+                coreIdle();
+                if (rcosTrace)
+                {
+                    traceRecordRaw(rcosTrace->cycles(), eTraceWake, PROCESS_NONE, PROCESS_NONE, EVENT_NONE);
+                }
+            }
+            executorIdleEnd(0);
+            globalIntEnable();
+            continue;
+        }
+        if (rcosDegraded && ((uint32_t)DEQUE_LOAD(&eventQueue.queue) * 100u <= (uint32_t)rcosDegraded->low * eventQueue.queue.size))
+        {
+            rcosDegraded->active = FALSE;
+        }
+        globalIntEnable();
+
+        coreHandle();
+    }
+}
+
+/** @} */
@@ -29,6 +29,9 @@
  *          @defgroup   EVENTS EVENTS
  *          @brief      Signals posted for different processes to run event specific functions.
  *
+ *          @defgroup   TOPICS TOPICS
+ *          @brief      Events published once and delivered to every subscribed process.
+ *
  *          @defgroup   PROCESS PROCESS
  *          @brief      Applications that decide how the system should react to each event.
  * 
@@ -53,12 +56,40 @@
  *
  *              @defgroup   TIMER_EVENT TIMER_EVENT
  *              @brief      Posts an event for target event handler after a period of time.
+ *
+ *              @defgroup   TIMER_POLL TIMER_POLL
+ *              @brief      Named groups of periodic functions that are all called from a single timer expiry.
+ *
+ *              @defgroup   TIMER_HR TIMER_HR
+ *              @brief      Microsecond timers on a free running hardware counter with compare interrupt.
+ *              @warning    Callbacks that are not deferred run in compare interrupt, same as TIMER_CALLBACK.
+ *
+ *              Callback and event timers have a slack, number of ticks their expiry may be delayed. Expiry is moved to
+ *              the tick with most trailing zero bits inside the slack window so nearby timers share one wake-up.
  * 
  *          @}
  * 
  *          @defgroup   DEBUGGING DEBUGGING
  *          @brief      Debug function defined to be used for libs/debug.h and target device creation
  * 
+ *          @defgroup   PROFILER PROFILER
+ *          @brief      Cycle statistics of event handlers for each process and event pair
+ * 
+ *          @defgroup   TRACE TRACE
+ *          @brief      Binary records of event posts, dispatches, timers and idle periods kept in a RAM ring
+ *
+ *          @defgroup   RECORD RECORD
+ *          @brief      Recording of external inputs with their ticks and replay of them to reproduce a run
+ *
+ *          @defgroup   EXECUTOR EXECUTOR
+ *          @brief      Dispatching groups of processes on separate threads of a multi-threaded platform
+ *
+ *          @defgroup   BOOT BOOT
+ *          @brief      Asynchronous and lazy device initialization and process start after their devices are ready
+ *
+ *          @defgroup   WATERMARK WATERMARK
+ *          @brief      High-water marks of stack, event queues, deques and registered buffers
+ * 
  *      @}
  *
  *      @defgroup   MW MW
@@ -70,6 +101,7 @@
 #include "libs/libs.h"
 #include "libs/deque.h"
 #include "libs/list_dl.h"
+#include "libs/pool.h"
 #include "dev/dev.h"
 
 #ifndef FILE_CORE_C
@@ -114,6 +146,280 @@ INTERFACE int rcosDebugPrint(const char *format, ...);
 
 /** @} */
 
+/** @addtogroup PROFILER
+ *  @{
+ */
+
+/// @brief  Number of histogram buckets, bucket n counts durations in [2^n, 2^(n+1)) cycles and last one the longer ones
+#ifndef CORE_PROFILER_BUCKETS
+#define CORE_PROFILER_BUCKETS (32)
+#endif
+
+/// @brief  Statistics of one process and event pair
+typedef struct
+{
+    tProcessEnum process;                      ///< Process enumeration
+    tEventEnum event;                          ///< Event enumeration, EVENT_PT for protothread runs
+    uint32_t count;                            ///< Number of handler calls, 0 for an unused entry
+    uint64_t total;                            ///< Total cycles spent
+    uint32_t min;                              ///< Shortest call in cycles
+    uint32_t max;                              ///< Longest call in cycles
+    uint32_t histogram[CORE_PROFILER_BUCKETS]; ///< Number of calls per log2 of cycles spent
+} tsProfilerEntry;
+
+/// @brief  Profiler table and its cycle source
+typedef struct
+{
+    tsProfilerEntry *entries; ///< Table of entries, placed by a hash of process and event
+    uint16_t size;            ///< Number of entries
+    uint16_t missed;          ///< Number of calls not recorded because table was full
+    uint32_t (*cycles)(void); ///< Free running cycle counter, wrap around is allowed
+    uint32_t frequency;       ///< Cycles per second
+} tsProfiler;
+
+/** @brief      Used for enabling the profiler in main.c, event handlers are not measured without it
+ *  @details    Platforms supply CORE_PROFILER_DEFAULT with their own cycle source.
+ *  @param      _entries    Number of process and event pairs that can be recorded
+ *  @param      _cycles     Function returning a free running cycle counter
+ *  @param      _frequency  Frequency of cycle counter in Hz
+ */
+#define CORE_PROFILER_CREATE(_entries, _cycles, _frequency)                                      \
+    tsProfilerEntry rcosProfilerEntries[_entries];                                               \
+    tsProfiler rcosProfilerObj = {rcosProfilerEntries, (_entries), 0, (_cycles), (_frequency)}; \
+    tsProfiler *rcosProfiler   = &rcosProfilerObj;
+
+INTERFACE tsProfiler *rcosProfiler __attribute__((weak));
+
+/** @brief  Get statistics of a process and event pair
+ *  @param  process Process enumeration
+ *  @param  event   Event enumeration, EVENT_PT for protothread runs
+ *  @return Pointer to entry, NULL if profiler is not created or pair has not run yet
+ */
+INTERFACE const tsProfilerEntry *profilerGet(tProcessEnum process, tEventEnum event);
+
+/// @brief  Clear all statistics
+INTERFACE void profilerReset(void);
+
+/** @brief  Print all statistics in json format
+ *  @details Output is an object with frequency, missed and an array of entries with process, event, count, total, min,
+ *           max and histogram items. Trailing empty buckets of histogram are not printed.
+ *  @param  print   printf like function used as json stream
+ */
+INTERFACE void profilerDump(int (*print)(const char *format, ...));
+
+/** @} */
+
+/** @addtogroup TRACE
+ *  @{
+ */
+
+/// @brief  Version of trace record format, placed in eTraceSync records
+#define CORE_TRACE_VERSION (1)
+
+/// @brief  Kind of a trace record, values are part of the record format
+typedef enum
+{
+    eTraceSync     = 0,  ///< Start of trace, time holds cycle frequency, source and destination 'R' 'T', event CORE_TRACE_VERSION
+    eTraceLost     = 1,  ///< Records lost since ring was full, count is in source(LSB), destination and event(MSB)
+    eTracePost     = 2,  ///< Event posted from process context
+    eTracePostIsr  = 3,  ///< Event posted from an isr
+    eTraceCoalesce = 4,  ///< Event dropped as the same event is already waiting
+    eTraceBegin    = 5,  ///< Handler called for event
+    eTraceEnd      = 6,  ///< Handler returned
+    eTraceTimer    = 7,  ///< Timer event expired and posted
+    eTraceCallBack = 8,  ///< Timer callback called, source and destination are PROCESS_NONE
+    eTraceIdle     = 9,  ///< Core went to tickless idle
+    eTraceWake     = 10, ///< Core woke up from tickless idle
+    eTraceDrop     = 11, ///< New event dropped or rejected by quota of destination
+    eTraceDropOld  = 12, ///< Waiting event dropped by quota of destination to make room, record holds the dropped event
+    eTraceOverrun  = 13, ///< Call exceeded budget of destination, source holds ticks spent saturated at 255
+} teTraceKind;
+
+/// @brief  One trace record, 8 bytes little endian on the wire
+typedef struct
+{
+    uint32_t time;            ///< Cycle counter, wraps around
+    uint8_t kind;             ///< teTraceKind
+    tProcessEnum source;      ///< Source process
+    tProcessEnum destination; ///< Destination process
+    tEventEnum event;         ///< Event
+} tsTraceRecord;
+
+/// @brief  Trace ring and its cycle source
+typedef struct
+{
+    tsTraceRecord *records;   ///< Ring of records
+    uint16_t size;            ///< Number of records in ring
+    uint16_t head;            ///< Next record to write
+    uint16_t tail;            ///< Next record to send
+    uint16_t count;           ///< Number of records waiting
+    uint8_t offset;           ///< Bytes of tail record already sent
+    uint8_t active;           ///< Records are taken while set
+    uint32_t lost;            ///< Records lost since last eTraceLost record
+    uint32_t (*cycles)(void); ///< Free running cycle counter, wrap around is allowed
+    uint32_t frequency;       ///< Cycles per second
+} tsTrace;
+
+/** @brief      Used for enabling the trace in main.c, nothing is recorded without it
+ *  @details    Platforms supply CORE_TRACE_DEFAULT with their own cycle source. Trace starts with coreInit.
+ *  @param      _records    Number of records in ring
+ *  @param      _cycles     Function returning a free running cycle counter
+ *  @param      _frequency  Frequency of cycle counter in Hz
+ */
+#define CORE_TRACE_CREATE(_records, _cycles, _frequency)                                              \
+    tsTraceRecord rcosTraceRecords[_records];                                                         \
+    tsTrace rcosTraceObj = {rcosTraceRecords, (_records), 0, 0, 0, 0, 0, 0, (_cycles), (_frequency)}; \
+    tsTrace *rcosTrace   = &rcosTraceObj;
+
+INTERFACE tsTrace *rcosTrace __attribute__((weak));
+
+/// @brief  Clear the ring and start recording with an eTraceSync record
+INTERFACE void traceStart(void);
+
+/// @brief  Stop recording, records in ring can still be drained
+INTERFACE void traceStop(void);
+
+/** @brief  Send waiting records through a communication device
+ *  @details Records are sent as a byte stream, a record partially accepted by the device is completed on next call.
+ *           Should be called from process context, tools/trace2json converts the stream to Chrome trace json.
+ *  @param  device  Communication device pointer
+ *  @return Number of bytes sent
+ */
+INTERFACE uint16_t traceDrain(const tsDevCom *device);
+
+/** @} */
+
+/** @addtogroup RECORD
+ *  @{
+ */
+
+/// @brief  Kind of an input record, values are part of the record format
+typedef enum
+{
+    eRecordIsrPost      = 0, ///< Event posted with eventPostFromIsr, id is destination
+    eRecordIsrPostFront = 1, ///< Event posted with eventPostInIsr, id is destination
+    eRecordComReceive   = 2, ///< Data returned by devComReceive, id is device index
+    eRecordIoGet        = 3, ///< Changed value returned by devIoGet, id is device index and data is little endian
+    eRecordKindCount,
+} teRecordKind;
+
+/// @brief  Heading of an input record, 8 bytes little endian in storage followed by length bytes of data
+typedef struct
+{
+    uint32_t tick;  ///< Ticks since recordStart
+    uint8_t kind;   ///< teRecordKind
+    uint8_t id;     ///< Destination process or device index
+    uint8_t event;  ///< Event enumeration of posts, 0 otherwise
+    uint8_t length; ///< Length of data
+} tsRecordHeading;
+
+/// @brief  State of recorder
+typedef enum
+{
+    eRecordOff    = 0, ///< Inputs pass through
+    eRecordOn     = 1, ///< Inputs are recorded
+    eRecordReplay = 2, ///< Inputs of recorded kinds are ignored, recorded ones are fed back
+} teRecordMode;
+
+/// @brief  Recorder of external inputs
+typedef struct
+{
+    uint8_t *ring;           ///< Records waiting for recordDrain
+    uint16_t size;           ///< Size of ring in bytes
+    uint16_t head;           ///< Next byte to write
+    uint16_t count;          ///< Bytes waiting
+    uint8_t mode;            ///< teRecordMode
+    uint8_t deviceMax;       ///< Number of devices that can be registered, 32 at most
+    uint8_t deviceCount;     ///< Number of registered devices
+    uint32_t known;          ///< Devices that have a value, bit of each device index
+    const void **devices;    ///< Registered devices, index is the id of their records
+    uint32_t *values;        ///< Last devIoGet value of each device
+    const tsDevMem *mem;     ///< Storage of records
+    uint32_t address;        ///< Start of storage area
+    uint32_t length;         ///< Size of storage area
+    uint32_t offset;         ///< Next byte to write or read in storage area
+    uint32_t start;          ///< rcosTickCount of recordStart or replayStart
+    uint32_t lost;           ///< Records lost while ring or storage was full
+    tsRecordHeading next;    ///< Next record to replay
+    uint8_t nextReady;       ///< next is read from storage
+    uint8_t nextTaken;       ///< Bytes of next given to devComReceive
+    uint8_t nextData[0xFF];  ///< Data of next
+} tsRecorder;
+
+/** @brief      Used for enabling the recorder in main.c
+ *  @details    Inputs that come from outside are recorded with their ticks: events posted from isrs, data received
+ *              by communication devices and changes of values read from I/O devices. Devices must be registered with
+ *              recordDevice in the same order for recording and replay, inputs of other devices are not recorded.
+ *              Replay feeds the same inputs at the same ticks while live inputs of recorded kinds are ignored, so a
+ *              run can be repeated with changed handlers. Running replay with CORE_TICK_CREATE_SIMULATION also
+ *              repeats the order of timers exactly.
+ *  @param      _ring       Size of RAM ring in bytes that keeps records until recordDrain
+ *  @param      _devices    Number of devices that can be registered, 32 at most
+ */
+#define CORE_RECORDER_CREATE(_ring, _devices)                                                                      \
+    uint8_t rcosRecorderRing[_ring];                                                                                \
+    const void *rcosRecorderDevices[_devices];                                                                      \
+    uint32_t rcosRecorderValues[_devices];                                                                          \
+    tsRecorder rcosRecorderObj = {.ring = rcosRecorderRing, .size = (_ring), .deviceMax = (_devices),              \
+                                  .devices = rcosRecorderDevices, .values = rcosRecorderValues};                    \
+    tsRecorder *rcosRecorder   = &rcosRecorderObj;
+
+INTERFACE tsRecorder *rcosRecorder __attribute__((weak));
+
+/** @brief  Register a communication or I/O device whose inputs are recorded and replayed
+ *  @param  device  Device pointer
+ *  @retval EXIT_FAILURE Recorder is not created or device table is full
+ *  @retval EXIT_SUCCESS
+ */
+INTERFACE uint8_t recordDevice(const void *device);
+
+/** @brief  Start recording inputs into a storage area, area must be erased beforehand if device requires it
+ *  @param  mem     Memory device pointer
+ *  @param  address Start of storage area
+ *  @param  length  Size of storage area
+ *  @retval EXIT_FAILURE Recorder is not created
+ *  @retval EXIT_SUCCESS
+ */
+INTERFACE uint8_t recordStart(const tsDevMem *mem, uint32_t address, uint32_t length);
+
+/** @brief  Start feeding inputs recorded in a storage area
+ *  @details Live inputs stay ignored after the last record until recordStop, replay is complete when nextReady is 0.
+ *  @param  mem     Memory device pointer
+ *  @param  address Start of storage area
+ *  @param  length  Size of storage area
+ *  @retval EXIT_FAILURE Recorder is not created
+ *  @retval EXIT_SUCCESS
+ */
+INTERFACE uint8_t replayStart(const tsDevMem *mem, uint32_t address, uint32_t length);
+
+/// @brief  Stop recording or replay, records waiting in ring can still be drained
+INTERFACE void recordStop(void);
+
+/** @brief  Write waiting records into storage area
+ *  @details Should be called from process context, storage may be slower than inputs arrive.
+ *  @return Number of bytes written
+ */
+INTERFACE uint16_t recordDrain(void);
+
+/** @brief  Used by device functions to replace an input of a registered device with the replayed one
+ *  @param  kind    eRecordComReceive or eRecordIoGet
+ *  @param  device  Device pointer
+ *  @param  data    Buffer to fill
+ *  @param  length  Size of buffer, replaced with number of bytes given. 0 asks number of bytes waiting
+ *  @return TRUE if device is replayed and live input must not be used
+ */
+INTERFACE teBool replayInput(teRecordKind kind, const void *device, void *data, uint16_t *length);
+
+/** @brief  Used by device functions to record an input of a registered device
+ *  @param  kind    eRecordComReceive or eRecordIoGet
+ *  @param  device  Device pointer
+ *  @param  data    Input data
+ *  @param  length  Length of data
+ */
+INTERFACE void recordInput(teRecordKind kind, const void *device, const void *data, uint16_t length);
+
+/** @} */
+
 /** @addtogroup EVENTS
  *  @{
  */
@@ -125,12 +431,183 @@ typedef struct
     tProcessEnum destination; ///< Target event processor enumeration
     tEventEnum event;         ///< Event enumeration dependant on target
     uint8_t length;           ///< Length of data that accompanies the event
+    uint8_t flags;            ///< EVENT_FLAG_...
+    uint8_t sequence;         ///< Signal ring position when queued, events posted to the ring before it are dispatched first
 } tsEventPost;
 
-/// @brief  Used for creating eventQueue object in main.c
+/// @brief  Event flag, data of event is a reference to an event buffer instead of a copy of the bytes
+#define EVENT_FLAG_REF (0x01u)
+/// @brief  Event flag, event is a topic record delivered to each subscriber of its topic
+#define EVENT_FLAG_TOPIC (0x02u)
+/// @brief  Event flags of an EVENT_PT post, slot of the protothread that will run
+#define EVENT_FLAG_SLOT(_slot) ((uint8_t)(((_slot) & 0x07u) << 4))
+/// @brief  Protothread slot of an EVENT_PT post
+#define EVENT_SLOT(_flags) (((_flags) >> 4) & 0x07u)
+
+/// @brief  Heading of an event buffer, placed just before the data returned by eventBufAlloc
+typedef struct
+{
+    uint16_t refs;   ///< Number of references, buffer goes back to pool when it drops to 0
+    uint16_t length; ///< Length of data posted with the buffer
+} tsEventBuf;
+
+/** @brief  Used for creating the event buffer pool in main.c, eventBufAlloc fails without it
+ *  @param  _count  Number of buffers
+ *  @param  _size   Largest data length a buffer can carry
+ */
+#define CORE_EVENTBUF_POOL(_count, _size)                           \
+    POOL_CREATE(eventBufPool, _count, sizeof(tsEventBuf) + (_size)) \
+    tsPool *rcosEventBufPool = &eventBufPool;
+
+INTERFACE tsPool *rcosEventBufPool __attribute__((weak));
+
+/// @brief  Number of process priority levels, events of higher priority processes are always dispatched first
+#ifndef CORE_PRIORITY_LEVELS
+#define CORE_PRIORITY_LEVELS (4)
+#endif
+
+/// @brief  Priority of processes created with PROCESS_CREATE, they share the queue created with CORE_EVENTQUEUE_SIZE
+#define CORE_PRIORITY_DEFAULT (0)
+
+/** @brief      Number of events dispatched from a queue before next queue with the same priority is served
+ *  @details    Queues of the same priority are served round-robin, 0 serves a queue until it is empty.
+ */
+#ifndef CORE_EVENTQUEUE_BURST
+#define CORE_EVENTQUEUE_BURST (1)
+#endif
+
+/** @brief      Number of events without data each queue keeps as packed 32-bit signals, power of 2 up to 64
+ *  @details    Events without data, like button presses and timer expiries, are written to a ring of words instead of
+ *              the byte queue, one store to post and one load to dispatch. Events with data carry the ring position
+ *              they were posted at so both are dispatched in posted order. Signals go to the byte queue while the
+ *              ring is full. 0 puts every event into the byte queue.
+ */
+#ifndef CORE_EVENTQUEUE_SIGNALS
+#define CORE_EVENTQUEUE_SIGNALS (16)
+#endif
+
+#if (CORE_EVENTQUEUE_SIGNALS & (CORE_EVENTQUEUE_SIGNALS - 1)) || (CORE_EVENTQUEUE_SIGNALS > 64)
+#error CORE_EVENTQUEUE_SIGNALS must be a power of 2 up to 64
+#endif
+
+/// @brief  Structure to define an event queue for a process
+typedef struct
+{
+    tsLdlItem _li;              ///< Ready list connection, linked while queue has events
+    tsDeque queue;              ///< Double Ended Queue to hold events and their data
+    struct _tsProcess *process; ///< Target process, NULL for the shared queue
+    uint16_t evCntLoad;         ///< Current number of events in queue
+    uint16_t evCntMax;          ///< Maximum number of events waited in queue
+    uint8_t group;              ///< Executor group that dispatches events of queue
+#if CORE_EVENTQUEUE_SIGNALS
+    uint32_t signals[CORE_EVENTQUEUE_SIGNALS]; ///< Ring of events without data, destination | source << 8 | event << 16 | flags << 24
+    uint8_t signalHead;                        ///< Next ring position to write, free running
+    uint8_t signalTail;                        ///< Next ring position to read, free running
+    uint8_t signalLoad;                        ///< Number of events waiting in ring, removed ones are left as PROCESS_NONE
+    uint8_t signalMax;                         ///< Maximum number of events waited in ring
+#endif
+} tsEventQueue;
+
+/** @brief  Initialized event queue structure
+ *  @param  _processPtr Target process, NULL for a queue shared by processes without their own queue
+ *  @param  _buffer     Array to hold events
+ */
+#define EVENT_QUEUE_INIT(_processPtr, _buffer) \
+    {                                          \
+        ._li       = LIST_DL_ITEM_INIT(),      \
+        .queue     = DEQUE_INIT(_buffer),      \
+        .process   = (_processPtr),            \
+        .evCntLoad = 0,                        \
+        .evCntMax  = 0,                        \
+        .group     = 0,                        \
+    }
+
+/** @brief  Create an event queue object named _name##EvQue for a process
+ *  @param  _name       Name prefix of the queue and its buffer
+ *  @param  _processPtr Target process
+ *  @param  _size       Size of queue in bytes, each event takes sizeof(tsEventPost) + its data length
+ */
+#define EVENT_QUEUE_CREATE(_name, _processPtr, _size) \
+    uint8_t _name##EvQueBuff[_size];                  \
+    tsEventQueue _name##EvQue = EVENT_QUEUE_INIT(_processPtr, _name##EvQueBuff);
+
+/// @brief  Used for creating the shared eventQueue object in main.c
 #define CORE_EVENTQUEUE_SIZE(_size)  \
     uint8_t eventQueueBuffer[_size]; \
-    volatile tsDeque eventQueue = DEQUE_INIT(eventQueueBuffer);
+    tsEventQueue eventQueue = EVENT_QUEUE_INIT(NULL, eventQueueBuffer);
+
+/// @brief  Action taken when a post exceeds quota of its destination or its queue is full
+typedef enum
+{
+    eOverloadDropNew,    ///< New event is dropped
+    eOverloadDropOldest, ///< Oldest waiting events of the destination are dropped to make room
+    eOverloadCoalesce,   ///< New event without data is merged into the same waiting event, dropped if there is none
+    eOverloadReject,     ///< New event is dropped and reject function of quota is called
+} teOverloadPolicy;
+
+/// @brief  Counters of dropped events
+typedef struct
+{
+    uint16_t dropNew;    ///< New events dropped by eOverloadDropNew or when nothing could be dropped for room
+    uint16_t dropOldest; ///< Waiting events dropped by eOverloadDropOldest
+    uint16_t coalesced;  ///< New events merged into a waiting event
+    uint16_t rejected;   ///< New events dropped by eOverloadReject
+    uint16_t noProcess;  ///< Events posted to a process that does not exist, only counted in eventDrops
+} tsEventDrops;
+
+/// @brief  Queue quota of a destination process, waiting events include the one being handled
+typedef struct
+{
+    uint16_t limit;                                             ///< Largest number of waiting events, 0 for no limit
+    uint16_t high;                                              ///< Destination is congested from this many waiting events, 0 to disable
+    uint16_t low;                                               ///< Congestion ends when waiting events drop to this
+    uint8_t policy;                                             ///< teOverloadPolicy
+    uint8_t congested;                                          ///< Set between high and low watermarks
+    void (*reject)(tProcessEnum destination, tEventEnum event); ///< Called for rejected posts with interrupts disabled, can be NULL
+    tsEventDrops drops;                                         ///< Drop counters of destination
+} tsEventQuota;
+
+/** @brief  Create a quota object, assign it to tsProcess quota in process init function
+ *  @param  _name   Name of quota object
+ *  @param  _limit  Largest number of waiting events, 0 to apply policy only when queue is full
+ *  @param  _high   High watermark, 0 to disable congestion
+ *  @param  _low    Low watermark
+ *  @param  _policy teOverloadPolicy
+ *  @param  _reject Function called for rejected posts, NULL if not used
+ */
+#define EVENT_QUOTA_CREATE(_name, _limit, _high, _low, _policy, _reject) \
+    tsEventQuota _name = {(_limit), (_high), (_low), (_policy), 0, (_reject), {0, 0, 0, 0, 0}};
+
+/// @brief  Degraded mode of shared event queue
+typedef struct
+{
+    uint8_t high;                  ///< Occupancy in percent to enter degraded mode
+    uint8_t low;                   ///< Occupancy in percent to leave degraded mode
+    uint8_t active;                ///< Current state
+    uint8_t notified;              ///< State last passed to hook
+    void (*hook)(teBool degraded); ///< Called from coreRun when state changes
+} tsDegraded;
+
+/** @brief      Used for enabling degraded mode in main.c
+ *  @details    Hook is called from coreRun, outside of any handler, with TRUE when occupancy of the shared queue reaches
+ *              _high percent and with FALSE when it drops to _low percent. Processes of low importance can be stopped
+ *              or slowed down in the hook.
+ *  @param      _high   Occupancy in percent to enter degraded mode
+ *  @param      _low    Occupancy in percent to leave degraded mode
+ *  @param      _hook   Function called on state changes
+ */
+#define CORE_DEGRADED_MODE(_high, _low, _hook)                            \
+    tsDegraded rcosDegradedObj = {(_high), (_low), FALSE, FALSE, (_hook)}; \
+    tsDegraded *rcosDegraded   = &rcosDegradedObj;
+
+INTERFACE tsDegraded *rcosDegraded __attribute__((weak));
+
+/** @brief  Check if destination has reached high watermark of its quota
+ *  @param  destination Enumeration of target event process
+ *  @retval TRUE    Destination is congested, producers should slow down
+ *  @retval FALSE   Destination has no quota or it is not congested
+ */
+INTERFACE teBool eventCongested(tProcessEnum destination);
 
 /** @brief  Insert an event into queue with FIFO
  *  @param  destination Enumeration of target event process
@@ -156,6 +633,28 @@ INTERFACE uint8_t eventPostPone(void);
  */
 INTERFACE uint8_t eventPostInIsr(tProcessEnum destination, tEventEnum event);
 
+/// @brief  Number of events that can wait in the isr ingress ring, must be a power of 2
+#ifndef CORE_ISR_RING_SIZE
+#define CORE_ISR_RING_SIZE (16)
+#endif
+
+/// @brief  Largest data length an event posted with eventPostFromIsr can carry
+#ifndef CORE_ISR_EVENT_DATA
+#define CORE_ISR_EVENT_DATA (8)
+#endif
+
+/** @brief      Insert an event with data into isr ingress ring, works in and out of ISR
+ *  @details    Ring is lock-free for multiple producers, interrupts are not disabled while posting so nested isrs
+ *              can post at the same time. coreRun moves the events into process queues in the order they were posted.
+ *  @param      destination Enumeration of target event process
+ *  @param      event       Enumeration of event
+ *  @param      data        Pointer to location of data that will accompany event
+ *  @param      length      Length of data, not more than CORE_ISR_EVENT_DATA
+ *  @retval     EXIT_FAILURE Ring is full or data is too long
+ *  @retval     EXIT_SUCCESS
+ */
+INTERFACE uint8_t eventPostFromIsr(tProcessEnum destination, tEventEnum event, const void *data, uint8_t length);
+
 /** @brief  Reply an event post with another event
  *  @param  event   Enumeration of event
  *  @param  data    Pointer to the location of data that will accompany event
@@ -165,29 +664,133 @@ INTERFACE uint8_t eventPostInIsr(tProcessEnum destination, tEventEnum event);
  */
 INTERFACE uint8_t eventReply(tEventEnum event, const void *data, uint8_t length);
 
-INTERFACE tsEventPost eventCurrent; ///< Current event information
-INTERFACE uint8_t eventData[256];   ///< Data associated with current event
+/** @brief      Allocate a reference counted event buffer that is posted without copying its data
+ *  @details    Buffer is taken from the pool created with CORE_EVENTBUF_POOL and holds one reference for the caller.
+ *              Usage:
+ *              @code
+ *                  uint8_t *frame = eventBufAlloc(length);
+ *                  if (frame)
+ *                  {
+ *                      memcpy(frame, received, length);
+ *                      eventPostRef(PROCESS_PARSER, EVENT_FRAME, frame, length); // Reference goes with the event
+ *                  }
+ *                  ...
+ *                  // Inside PROCESS_PARSER handler
+ *                  parse(eventBuf, eventBufLength);  // Buffer is released after handler returns
+ *                  eventBufRetain(eventBuf);          // Unless another reference is taken to keep or forward it
+ *              @endcode
+ *  @param      size    Number of bytes needed
+ *  @return     Pointer to buffer data, NULL if pool is empty or size does not fit a buffer
+ */
+INTERFACE void *eventBufAlloc(uint16_t size);
 
-#if 0 // NOT NOW
-/// @brief  Structure to define an event queue for a process
+/** @brief  Take another reference to an event buffer
+ *  @param  buf Pointer returned by eventBufAlloc, NULL is ignored
+ */
+INTERFACE void eventBufRetain(void *buf);
+
+/** @brief  Drop a reference to an event buffer, buffer goes back to pool with the last reference
+ *  @param  buf Pointer returned by eventBufAlloc, NULL is ignored
+ */
+INTERFACE void eventBufRelease(void *buf);
+
+/** @brief  Insert an event into queue with FIFO that carries an event buffer instead of a copy of its data
+ *  @details Caller's reference to the buffer is passed to the event, it is released if the event cannot be posted.
+ *           Receiving handler finds the buffer in eventBuf and eventBufLength.
+ *  @param  destination Enumeration of target event process
+ *  @param  event       Enumeration of event
+ *  @param  buf         Pointer returned by eventBufAlloc
+ *  @param  length      Length of data in buffer, not more than allocated size
+ *  @retval EXIT_FAILURE
+ *  @retval EXIT_SUCCESS
+ */
+INTERFACE uint8_t eventPostRef(tProcessEnum destination, tEventEnum event, void *buf, uint16_t length);
+
+/// @brief  Storage class of variables kept for each dispatching thread, platforms with an executor define it
+#ifndef PLATFORM_THREAD_LOCAL
+#define PLATFORM_THREAD_LOCAL
+#endif
+
+INTERFACE PLATFORM_THREAD_LOCAL tsEventPost eventCurrent; ///< Current event information
+INTERFACE PLATFORM_THREAD_LOCAL uint8_t eventData[256];   ///< Data associated with current event
+INTERFACE tsEventDrops eventDrops;                        ///< Drop counters of all destinations
+INTERFACE PLATFORM_THREAD_LOCAL void *eventBuf;           ///< Event buffer of current event if posted with eventPostRef, NULL otherwise
+INTERFACE PLATFORM_THREAD_LOCAL uint16_t eventBufLength;  ///< Length of data in eventBuf
+
+
+/** @} */
+
+/** @addtogroup TOPICS
+ *  @{
+ *  @details    A publish places one record in the queue of publisher, its data is copied once and it takes the same space
+ *              for any number of subscribers. coreRun calls handlers of subscribers one after another with the
+ *              same eventCurrent and eventData, only eventCurrent.destination changes.
+ *              Usage:
+ *              @code
+ *                  TOPIC_CREATE(topicPowerFail, EVENT_POWER_FAIL, 4);
+ *                  ...
+ *                  // Inside init function of each interested process
+ *                  topicSubscribe(&topicPowerFail, process->enumeration);
+ *                  ...
+ *                  topicPublish(&topicPowerFail, &voltage, sizeof(voltage));
+ *              @endcode
+ *  @warning    Handlers must not modify eventData of a topic event, next subscribers see the same bytes.
+ */
+
+/// @brief  Topic object
 typedef struct
 {
-    tsLdl _li;               ///< List connection
-    tsDeque queue;            ///< Double Ended Queue to hold queue information
-    tsProcess *process;       ///< Target process
-} tsEventQueue;
+    tProcessEnum *subscribers; ///< Enumerations of subscribed processes
+    uint8_t size;              ///< Largest number of subscribers
+    uint8_t count;             ///< Number of subscribers
+    tEventEnum event;          ///< Event received by subscribers
+    uint32_t published;        ///< Number of publishes
+} tsTopic;
+
+/** @brief  Create a topic object
+ *  @param  _name           Name of topic object
+ *  @param  _event          Event that subscribers receive
+ *  @param  _subscribers    Largest number of subscribers
+ */
+#define TOPIC_CREATE(_name, _event, _subscribers)   \
+    tProcessEnum _name##Subscribers[_subscribers]; \
+    tsTopic _name = {_name##Subscribers, (_subscribers), 0, (tEventEnum)(_event), 0};
+
+/** @brief  Add a process to subscribers of a topic
+ *  @param  topic   Topic pointer
+ *  @param  process Enumeration of process
+ *  @retval EXIT_FAILURE Topic is full or process is already a subscriber
+ *  @retval EXIT_SUCCESS
+ */
+INTERFACE uint8_t topicSubscribe(tsTopic *topic, tProcessEnum process);
 
-#define EVENT_QUEUE_INIT(_processPtr, _buffer) \
-    {                                          \
-        ._li     = LIST_DL_ITEM_INIT(),        \
-        .queue   = DEQUE_INIT(_buffer),        \
-        .process = (_processPtr),              \
-    }
+/** @brief  Remove a process from subscribers of a topic
+ *  @param  topic   Topic pointer
+ *  @param  process Enumeration of process
+ *  @retval EXIT_FAILURE Process is not a subscriber
+ *  @retval EXIT_SUCCESS
+ */
+INTERFACE uint8_t topicUnsubscribe(tsTopic *topic, tProcessEnum process);
 
-#define EVENT_QUEUE_CREATE(_name, _processPtr, _size) \
-    uint8_t _name##EvQueBuff[_size];                  \
-    tsEventQueue _name##EvQue = EVENT_QUEUE_INIT(_processPtr, _name##EvQueBuff);
-#endif
+/** @brief  Insert one record into queue of publisher that is delivered to every subscriber of topic
+ *  @details Record has priority of publisher and counts against its quota, a full queue rejects it like an event.
+ *  @param  topic   Topic pointer
+ *  @param  data    Pointer to the location of data that will accompany event
+ *  @param  length  Length of data, a pointer less than 256 bytes
+ *  @retval EXIT_FAILURE
+ *  @retval EXIT_SUCCESS
+ */
+INTERFACE uint8_t topicPublish(tsTopic *topic, const void *data, uint8_t length);
+
+/** @brief  Publish an event buffer, a single reference is shared by all subscribers
+ *  @details Caller's reference to the buffer is passed to the record, it is released if the record cannot be posted.
+ *  @param  topic   Topic pointer
+ *  @param  buf     Pointer returned by eventBufAlloc
+ *  @param  length  Length of data in buffer, not more than allocated size
+ *  @retval EXIT_FAILURE
+ *  @retval EXIT_SUCCESS
+ */
+INTERFACE uint8_t topicPublishRef(tsTopic *topic, void *buf, uint16_t length);
 
 /** @} */
 
@@ -201,12 +804,31 @@ typedef struct
 /// @brief  Interrupt subroutine to be called every 1ms for TIMERS to work
 INTERFACE CORE_TICK_PROTO(rcosTickIsr);
 
+/** @brief  Interrupt subroutine for tickless platforms, processes all ticks that have passed since last call at once
+ *  @param  ticks   Number of 1ms ticks passed since last call
+ */
+INTERFACE void rcosTickIsrElapsed(uint32_t ticks);
+
+/// @brief  Number of ticks passed since coreRun, wraps around
+INTERFACE uint32_t rcosTickCount(void);
+
+/** @brief      Function prototype to program next tick expiry for tickless idle
+ *  @details    Called by coreRun with interrupts disabled when the event queue is empty. Function must stop the periodic
+ *              tick, sleep until ticks have passed or any interrupt occurs, call rcosTickIsrElapsed with the whole ticks
+ *              passed and restart the periodic tick before returning. Sleeping less than ticks is always allowed and
+ *              platform must wake early enough to refresh its watchdog.
+ *  @param      _name   Function name
+ *  @param      ticks   Number of ticks until next timer expiry, CORE_TIMER_PERIOD_MAX when no timer is armed
+ */
+#define CORE_TICK_PROGRAM_PROTO(_name) void _name(uint32_t ticks)
+
 /// @brief  Tick functions structure
 typedef struct
 {
-    void (*start)(void);   ///< Function to start tick timer
-    void (*enable)(void);  ///< Function to enable tick interrupt
-    void (*disable)(void); ///< Function to disable tick interrupt
+    void (*start)(void);             ///< Function to start tick timer
+    void (*enable)(void);            ///< Function to enable tick interrupt
+    void (*disable)(void);           ///< Function to disable tick interrupt
+    void (*program)(uint32_t ticks); ///< Function to program next expiry and sleep(tickless idle), NULL if not supported
 } tsTick;
 
 /** @brief  Creates rcosTick object.
@@ -216,11 +838,68 @@ typedef struct
  *  @param  _disable    Function to be called to disable timer interrupt
  */
 #define CORE_TICK_CREATE(_start, _enable, _disable) \
-    const tsTick rcosTick = {&(_start), &(_enable), &(_disable)};
+    const tsTick rcosTick = {&(_start), &(_enable), &(_disable), NULL};
+
+/** @brief  Creates rcosTick object with tickless idle support.
+ *          coreRun sleeps until next timer expiry instead of spinning when there is no event to process
+ *  @param  _start      Function to be called to start a 1ms timer interrupt to call rcosTickIsr
+ *  @param  _enable     Function to be called to enable timer interrupt
+ *  @param  _disable    Function to be called to disable timer interrupt
+ *  @param  _program    Function to program next tick expiry and sleep, see CORE_TICK_PROGRAM_PROTO
+ */
+#define CORE_TICK_CREATE_TICKLESS(_start, _enable, _disable, _program) \
+    const tsTick rcosTick = {&(_start), &(_enable), &(_disable), &(_program)};
 
 /// @brief  This object must be created in main.c with CORE_TICK_CREATE macro
 extern const tsTick rcosTick;
 
+/// @brief  Virtual time simulation settings, see CORE_TICK_CREATE_SIMULATION
+typedef struct
+{
+    uint32_t limit;    ///< rcosTickCount that simulation ends at, 0 for no limit
+    void (*end)(void); ///< Called once when simulation ends, NULL for none
+} tsTickSimulation;
+
+/** @brief      Creates rcosTick object that runs timers in virtual time instead of a tick interrupt.
+ *  @details    Whenever the event queue is empty coreRun moves rcosTickCount straight to the earliest armed generic,
+ *              callback or event timer and expires it, so hours of timer driven behaviour run in seconds. Handlers
+ *              take no virtual time and protothread yields wait for the next tick, timers expire in deadline order and
+ *              the run is repeatable as long as no other interrupt posts events. Simulation ends at _limit or when no
+ *              timer is left to wait for, _end usually prints results and exits. If it returns, coreRun goes on without
+ *              a limit.
+ *  @param      _limit  Length of simulation in ticks, 0 for no limit
+ *  @param      _end    Function called when simulation ends, NULL for none
+ */
+#define CORE_TICK_CREATE_SIMULATION(_limit, _end)                                                              \
+    const tsTickSimulation rcosSimulationObj = {(_limit), (_end)};                                             \
+    const tsTickSimulation *rcosSimulation   = &rcosSimulationObj;                                             \
+    const tsTick rcosTick = {&rcosSimulationTick, &rcosSimulationTick, &rcosSimulationTick, &rcosSimulationProgram};
+
+INTERFACE const tsTickSimulation *rcosSimulation __attribute__((weak));
+
+/// @brief  Start, enable and disable functions of simulation tick, there is no interrupt to control
+INTERFACE CORE_TICK_PROTO(rcosSimulationTick);
+
+/// @brief  Program function of simulation tick, advances virtual time to the next timer expiry
+INTERFACE void rcosSimulationProgram(uint32_t ticks);
+
+/** @brief      Number of index bits on the first level of timer wheels
+ *  @details    Software timers are kept on hierarchical timing wheels, start/stop and per tick work do not depend on the
+ *              number of armed timers. First level has a slot for each of the next 2^CORE_TIMER_WHEEL_L0_BITS ticks,
+ *              every upper level has 2^CORE_TIMER_WHEEL_LN_BITS slots that are cascaded down when the level below wraps.
+ */
+#ifndef CORE_TIMER_WHEEL_L0_BITS
+#define CORE_TIMER_WHEEL_L0_BITS (6)
+#endif
+
+/// @brief  Number of index bits on upper levels of timer wheels
+#ifndef CORE_TIMER_WHEEL_LN_BITS
+#define CORE_TIMER_WHEEL_LN_BITS (4)
+#endif
+
+/// @brief  Longest period a software timer can be started with, longer periods are limited to this value
+#define CORE_TIMER_PERIOD_MAX (0x7ffffffful)
+
 /** @} */
 
 /** @addtogroup TIMER_GENERIC
@@ -231,7 +910,7 @@ extern const tsTick rcosTick;
 typedef struct
 {
     tsLdlItem _li; /// @warning Used internally, do not modify!
-    uint32_t _cnt; /// @warning Used internally, do not modify!
+    uint32_t _cnt; /// @warning Used internally(expiry tick while running, 0 when expired), do not modify!
 } tsTimerGeneric;
 
 /// @brief  Initialized timer generic structure
@@ -285,9 +964,12 @@ struct _tsTimerCallBack
     uint32_t _cnt;                    ///< @warning Used internally, do not modify!
     TIMER_CALLBACK_FUNC((*callBack)); ///< Function to call after timer ends
     void *parameter;                  ///< Parameter passed to function
+    uint8_t deferred;                 ///< Call from coreRun ahead of events instead of rcosTickIsr
+    uint8_t _pending;                 ///< @warning Used internally(expired, waiting for coreRun), do not modify!
+    uint16_t slack;                   ///< Ticks that expiry may be delayed to share a wake-up with other timers
 };
 
-/** @brief  Initialized timer callback object
+/** @brief  Initialized timer callback object, function is called inside rcosTickIsr
  *  @param  _func Name of the function that will be called
  *  @param  _parameter Parameter that will be passed to the callback function
  */
@@ -297,6 +979,27 @@ struct _tsTimerCallBack
         ._cnt      = 0,                        \
         .callBack  = (_func),                  \
         .parameter = (void *)(_parameter),     \
+        .deferred  = 0,                        \
+        ._pending  = 0,                        \
+        .slack     = 0,                        \
+    }
+
+/** @brief      Initialized deferred timer callback object
+ *  @details    rcosTickIsr only queues the expired object, function is called at the top of coreRun loop before the
+ *              next event is dispatched. Interrupt latency does not grow with the duration of function and watchdog
+ *              covers it like an event handler. Timing jitter is bounded by the longest event handler.
+ *  @param      _func Name of the function that will be called
+ *  @param      _parameter Parameter that will be passed to the callback function
+ */
+#define TIMER_CALLBACK_INIT_DEFERRED(_func, _parameter) \
+    {                                                   \
+        ._li       = LIST_DL_ITEM_INIT(),               \
+        ._cnt      = 0,                                 \
+        .callBack  = (_func),                           \
+        .parameter = (void *)(_parameter),              \
+        .deferred  = 1,                                 \
+        ._pending  = 0,                                 \
+        .slack     = 0,                                 \
     }
 
 /** @brief  Creates a timer callback object
@@ -308,10 +1011,18 @@ struct _tsTimerCallBack
 #define TIMER_CALLBACK_CREATE(_name, _func, _parameter) \
     tsTimerCallBack _name = TIMER_CALLBACK_INIT(_func, _parameter);
 
+/** @brief  Creates a deferred timer callback object, see TIMER_CALLBACK_INIT_DEFERRED
+ *  @param  _name Name of the timer callback object
+ *  @param  _func Name of the function that will be called
+ *  @param  _parameter Parameter that will be passed to the callback function
+ */
+#define TIMER_CALLBACK_CREATE_DEFERRED(_name, _func, _parameter) \
+    tsTimerCallBack _name = TIMER_CALLBACK_INIT_DEFERRED(_func, _parameter);
+
 /** @brief      Start a timer to call a function with a period of time for a number of times.
  *  @warning    Timer with callback function is unsecure, it cannot be controled by reliability functions (system reset mechanism)!
  *              If the callback function duration is greater than wdt period, wdt reset occures. However, the reset reason won't be recorded!
- *              Do not use if you are not obliged to!
+ *              Do not use if you are not obliged to! Prefer deferred objects unless function needs interrupt context.
  *  @param[in]  obj         Target object that will be processed inside rcosTickIsr
  *  @param[in]  period      Period of time that the timer will run
  *  @param[out] obj target object is processed
@@ -320,6 +1031,15 @@ struct _tsTimerCallBack
  */
 INTERFACE uint8_t timerCallBackStart(tsTimerCallBack *obj, uint32_t period);
 
+/** @brief      Set slack of a timer callback object and start it, later starts and restarts keep the slack
+ *  @param[in]  obj         Target object that will be processed inside rcosTickIsr
+ *  @param[in]  period      Period of time that the timer will run
+ *  @param[in]  slack       Ticks that each expiry may be delayed, 0 for exact expiry
+ *  @retval     EXIT_FAILURE
+ *  @retval     EXIT_SUCCESS
+ */
+INTERFACE uint8_t timerCallBackStartSlack(tsTimerCallBack *obj, uint32_t period, uint16_t slack);
+
 /** @brief      Remove a running timer and reset parameters of it
  *  @param[in]  obj     Target object that will be processed inside rcosTickIsr
  *  @param[out] obj     Target object is processed
@@ -340,6 +1060,7 @@ typedef struct
     tsLdlItem _li;    ///< @warning Used internally, do not modify!
     uint32_t _cnt;    ///< @warning Used internally, do not modify!
     tsEventPost post; ///< Event that will be posted after timeout(no data)
+    uint16_t slack;   ///< Ticks that expiry may be delayed to share a wake-up with other timers
 } tsTimerEvent;
 
 /** @brief  Initialized timer event object
@@ -357,7 +1078,8 @@ typedef struct
             .destination = (tProcessEnum)(_dst), \
             .event       = (tEventEnum)(_event), \
             .length      = 0                     \
-        }                                        \
+        },                                       \
+        .slack = 0,                              \
     }
 
 /** @brief  Create an event timer object
@@ -378,6 +1100,15 @@ typedef struct
  */
 INTERFACE uint8_t timerEventStart(tsTimerEvent *obj, uint32_t duration);
 
+/** @brief      Set slack of an event timer and start it, later starts keep the slack
+ *  @param[in]  obj         Target object that will be processed inside rcosTickIsr
+ *  @param[in]  duration    Timeout to send event in milliseconds
+ *  @param[in]  slack       Ticks that event may be delayed, 0 for exact timeout
+ *  @retval     EXIT_FAILURE
+ *  @retval     EXIT_SUCCESS
+ */
+INTERFACE uint8_t timerEventStartSlack(tsTimerEvent *obj, uint32_t duration, uint16_t slack);
+
 /** @brief      Remove sw timer from list
  *  @param[in]  obj     Target object that will be processed inside rcosTickIsr
  *  @param[out] obj     Target object is processed
@@ -388,6 +1119,241 @@ INTERFACE uint8_t timerEventStop(tsTimerEvent *obj);
 
 /** @} */
 
+/** @addtogroup TIMER_POLL
+ *  @{
+ */
+
+/// @brief  Member of a poll group
+typedef struct
+{
+    tsLdlItem _li;                    ///< @warning Used internally, do not modify!
+    TIMER_CALLBACK_FUNC((*callBack)); ///< Function called on each expiry of group, returns 0 to leave the group
+    void *parameter;                  ///< Parameter passed to function
+} tsTimerPollMember;
+
+/// @brief  Poll group, members are called one after another from one timer
+typedef struct
+{
+    tsTimerCallBack timer; ///< @warning Used internally, do not modify!
+    tsLdl members;         ///< @warning Used internally, do not modify!
+    uint32_t period;       ///< Period of group
+} tsTimerPollGroup;
+
+/// @brief  Timer function of poll groups
+INTERFACE TIMER_CALLBACK_FUNC(timerPollRun);
+
+/** @brief  Creates a poll group, group timer runs while the group has members
+ *  @param  _name       Name of poll group object
+ *  @param  _period     Period of group in ticks
+ *  @param  _slack      Ticks that each expiry of group may be delayed
+ *  @param  _deferred   1 to call members from coreRun, 0 to call them inside rcosTickIsr
+ */
+#define TIMER_POLL_GROUP_CREATE(_name, _period, _slack, _deferred) \
+    tsTimerPollGroup _name =                                       \
+        {                                                          \
+            .timer =                                               \
+                {                                                  \
+                    ._li       = LIST_DL_ITEM_INIT(),              \
+                    ._cnt      = 0,                                \
+                    .callBack  = timerPollRun,                     \
+                    .parameter = &(_name),                         \
+                    .deferred  = (_deferred),                      \
+                    ._pending  = 0,                                \
+                    .slack     = (_slack),                         \
+                },                                                 \
+            .members = LIST_DL_INIT(),                             \
+            .period  = (_period),                                  \
+    };
+
+/** @brief  Initialized poll group member
+ *  @param  _func Name of the function that will be called
+ *  @param  _parameter Parameter that will be passed to the function
+ */
+#define TIMER_POLL_MEMBER_INIT(_func, _parameter) \
+    {                                             \
+        ._li       = LIST_DL_ITEM_INIT(),         \
+        .callBack  = (_func),                     \
+        .parameter = (void *)(_parameter),        \
+    }
+
+/** @brief  Creates a poll group member
+ *  @param  _name Name of member object
+ *  @param  _func Name of the function that will be called
+ *  @param  _parameter Parameter that will be passed to the function
+ */
+#define TIMER_POLL_MEMBER_CREATE(_name, _func, _parameter) \
+    tsTimerPollMember _name = TIMER_POLL_MEMBER_INIT(_func, _parameter);
+
+/** @brief      Add a member to a poll group, group timer is started with the first member
+ *  @param[in]  group   Poll group
+ *  @param[in]  member  Member that is not in any group
+ *  @retval     EXIT_FAILURE Member has no function or it is already in the group
+ *  @retval     EXIT_SUCCESS
+ */
+INTERFACE uint8_t timerPollJoin(tsTimerPollGroup *group, tsTimerPollMember *member);
+
+/** @brief      Remove a member from its poll group, group timer is stopped with the last member
+ *  @param[in]  group   Poll group
+ *  @param[in]  member  Member of group
+ *  @retval     EXIT_FAILURE
+ *  @retval     EXIT_SUCCESS
+ */
+INTERFACE uint8_t timerPollLeave(tsTimerPollGroup *group, tsTimerPollMember *member);
+
+/** @} */
+
+/** @addtogroup TIMER_HR
+ *  @details    Running timers are kept in a single queue sorted by deadline, compare interrupt is programmed for the head
+ *              only. Deadlines are counter values in microseconds and wrap around, periods up to CORE_TIMER_PERIOD_MAX
+ *              microseconds can be used. A periodic callback is restarted from its deadline, not from the time it has
+ *              run, so it does not drift. Expiries that are already missed are skipped instead of being called back to back.
+ *              High resolution timers are not available when rcosHrTimer is not created, start functions fail.
+ *  @{
+ */
+
+/// @brief  Microseconds that a high resolution event timer waits to retry when its event cannot be posted
+#ifndef CORE_HRTIMER_RETRY
+#define CORE_HRTIMER_RETRY (1000u)
+#endif
+
+/// @brief  High resolution counter functions
+typedef struct
+{
+    void (*start)(void);                ///< Start free running counter, called by coreRun
+    uint32_t (*now)(void);              ///< Read counter in microseconds
+    void (*program)(uint32_t deadline); ///< Arm compare interrupt, interrupt must occur at once if deadline is not in the future
+    void (*cancel)(void);               ///< Disarm compare interrupt
+} tsHrTimerHw;
+
+/** @brief  Creates rcosHrTimer object, compare interrupt of counter must call rcosHrTimerIsr
+ *  @param  _start      Function to start counter
+ *  @param  _now        Function to read counter in microseconds
+ *  @param  _program    Function to arm compare interrupt for a counter value
+ *  @param  _cancel     Function to disarm compare interrupt
+ */
+#define CORE_HRTIMER_CREATE(_start, _now, _program, _cancel)                          \
+    const tsHrTimerHw rcosHrTimerObj = {&(_start), &(_now), &(_program), &(_cancel)}; \
+    const tsHrTimerHw *rcosHrTimer   = &rcosHrTimerObj;
+
+INTERFACE const tsHrTimerHw *rcosHrTimer __attribute__((weak));
+
+/// @brief  Interrupt subroutine to be called on compare match of high resolution counter
+INTERFACE CORE_TICK_PROTO(rcosHrTimerIsr);
+
+/// @brief  High resolution callback timer object structure
+typedef struct
+{
+    tsLdlItem _li;                    ///< @warning Used internally, do not modify!
+    uint32_t _deadline;               ///< @warning Used internally(counter value of expiry while running), do not modify!
+    uint8_t _running;                 ///< @warning Used internally(in deadline queue), do not modify!
+    uint8_t _pending;                 ///< @warning Used internally(expired, waiting for coreRun), do not modify!
+    uint8_t deferred;                 ///< Call from coreRun ahead of events instead of compare interrupt
+    TIMER_CALLBACK_FUNC((*callBack)); ///< Function to call after timer ends, returns next period in microseconds, 0 to stop
+    void *parameter;                  ///< Parameter passed to function
+} tsHrTimerCallBack;
+
+/** @brief  Initialized high resolution callback timer object
+ *  @param  _func       Name of the function that will be called inside rcosHrTimerIsr
+ *  @param  _parameter  Parameter that will be passed to the callback function
+ *  @param  _deferred   1 to call function from coreRun, see TIMER_CALLBACK_INIT_DEFERRED
+ */
+#define HR_TIMER_CALLBACK_INIT(_func, _parameter, _deferred) \
+    {                                                        \
+        ._li       = LIST_DL_ITEM_INIT(),                    \
+        ._deadline = 0,                                      \
+        ._running  = 0,                                      \
+        ._pending  = 0,                                      \
+        .deferred  = (_deferred),                            \
+        .callBack  = (_func),                                \
+        .parameter = (void *)(_parameter),                   \
+    }
+
+/** @brief  Creates a high resolution callback timer object
+ *  @param  _name       Name of the timer object
+ *  @param  _func       Name of the function that will be called inside rcosHrTimerIsr
+ *  @param  _parameter  Parameter that will be passed to the callback function
+ */
+#define HR_TIMER_CALLBACK_CREATE(_name, _func, _parameter) \
+    tsHrTimerCallBack _name = HR_TIMER_CALLBACK_INIT(_func, _parameter, 0);
+
+/** @brief  Creates a deferred high resolution callback timer object, function is called from coreRun
+ *  @param  _name       Name of the timer object
+ *  @param  _func       Name of the function that will be called
+ *  @param  _parameter  Parameter that will be passed to the callback function
+ */
+#define HR_TIMER_CALLBACK_CREATE_DEFERRED(_name, _func, _parameter) \
+    tsHrTimerCallBack _name = HR_TIMER_CALLBACK_INIT(_func, _parameter, 1);
+
+/// @brief  High resolution event timer object structure
+typedef struct
+{
+    tsHrTimerCallBack timer; ///< @warning Used internally, do not modify!
+    tsEventPost post;        ///< Event that will be posted after timeout(no data)
+} tsHrTimerEvent;
+
+/// @brief  Timer function of high resolution event timers
+INTERFACE TIMER_CALLBACK_FUNC(hrTimerEventRun);
+
+/** @brief  Create a high resolution event timer object
+ *  @param  _name   Name of the timer object
+ *  @param  _src    Source process enumeration
+ *  @param  _dst    Destination process enumeration
+ *  @param  _event  Event enumeration that will be posted
+ */
+#define HR_TIMER_EVENT_CREATE(_name, _src, _dst, _event)                   \
+    tsHrTimerEvent _name =                                                 \
+        {                                                                  \
+            .timer = HR_TIMER_CALLBACK_INIT(hrTimerEventRun, &(_name), 0), \
+            .post  =                                                       \
+                {                                                          \
+                    .source      = (tProcessEnum)(_src),                   \
+                    .destination = (tProcessEnum)(_dst),                   \
+                    .event       = (tEventEnum)(_event),                   \
+                    .length      = 0,                                      \
+                },                                                         \
+    };
+
+/// @brief  Read high resolution counter in microseconds, 0 if rcosHrTimer is not created
+INTERFACE uint32_t hrTimerNow(void);
+
+/** @brief      Start a high resolution callback timer, a running timer is restarted
+ *  @param[in]  obj     Timer object
+ *  @param[in]  period  Microseconds until function is called
+ *  @retval     EXIT_FAILURE rcosHrTimer is not created
+ *  @retval     EXIT_SUCCESS
+ */
+INTERFACE uint8_t hrTimerCallBackStart(tsHrTimerCallBack *obj, uint32_t period);
+
+/** @brief      Start a high resolution callback timer to expire at a counter value, e.g. a delay from a captured edge
+ *  @param[in]  obj         Timer object
+ *  @param[in]  deadline    Counter value of expiry, it expires at once if it is not in the future
+ *  @retval     EXIT_FAILURE rcosHrTimer is not created
+ *  @retval     EXIT_SUCCESS
+ */
+INTERFACE uint8_t hrTimerCallBackStartAt(tsHrTimerCallBack *obj, uint32_t deadline);
+
+/** @brief      Stop a high resolution callback timer
+ *  @param[in]  obj     Timer object
+ *  @retval     EXIT_SUCCESS
+ */
+INTERFACE uint8_t hrTimerCallBackStop(tsHrTimerCallBack *obj);
+
+/** @brief      Start a high resolution event timer, a running timer is restarted
+ *  @param[in]  obj         Timer object
+ *  @param[in]  duration    Microseconds until event is posted
+ *  @retval     EXIT_FAILURE rcosHrTimer is not created or there is no destination
+ *  @retval     EXIT_SUCCESS
+ */
+INTERFACE uint8_t hrTimerEventStart(tsHrTimerEvent *obj, uint32_t duration);
+
+/** @brief      Stop a high resolution event timer
+ *  @param[in]  obj     Timer object
+ *  @retval     EXIT_SUCCESS
+ */
+INTERFACE uint8_t hrTimerEventStop(tsHrTimerEvent *obj);
+
+/** @} */
+
 /// @brief      Process object structure
 /// @ingroup    PROCESS
 typedef struct _tsProcess tsProcess;
@@ -396,7 +1362,10 @@ typedef struct _tsProcess tsProcess;
  *  @details    http://dunkels.com/adam/pt/index.html.
  *  @warning    lc-switch method is used. meaning; switch/case cannot be used inside a protothread funciton.
  *  @warning    No Hierarchical protothreads. Child protothreads cannot be started.
- *  @warning    Thread variables are hidden inside tsProcess and THERE CAN BE ONLY ONE.
+ *  @details    A process has a static array of thread slots, one for PROCESS_CREATE and up to CORE_THREADS_MAX with
+ *              PROCESS_CREATE_THREADS. Each slot has its own local continuation, wake timer and timeout counter so
+ *              independent flows of a process, like a command and a flash write, run interleaved. threadStart and
+ *              threadStop use slot 0, threadStartSlot and threadStopSlot pick a slot.
  *  @code
  *      PT_THREAD(myThread)
  *      {
@@ -456,7 +1425,7 @@ typedef struct _tsProcess tsProcess;
  */
 
 /// @brief      Declaration of a protothread.
-/// @details    We're using our process as the protothread structure, hence no need to declare separately
+/// @details    Thread structures are kept in thread slots of the process, hence no need to declare separately
 /// @warning    name_args should have only the name
 /// @param      name_args Name of the task function for this thread
 #define PT_THREAD(name_args) uint32_t name_args(tsProcess *process, struct _tsThread *thread)
@@ -464,15 +1433,29 @@ typedef struct _tsProcess tsProcess;
 /// @brief  Thread structure
 typedef struct _tsThread
 {
-    int16_t lc; ///< Protothread, Local continuations variable
+    int16_t lc;    ///< Protothread, Local continuations variable
+    uint32_t tgen; ///< Protothread, timeout operations
 } tsThread;
 
 /// @brief  Initialize a tsThread structure.
 #define THREAD_INIT() \
     {                 \
-        .lc = 0,      \
+        .lc   = 0,    \
+        .tgen = 0,    \
     }
 
+/// @brief  Largest number of protothread slots of a process
+#define CORE_THREADS_MAX (8)
+
+/// @brief  Protothread slot of a process
+typedef struct
+{
+    PT_THREAD((*threadFunction)); ///< Protothread, function
+    tsThread thread;              ///< Protothread, local continuation and timeout
+    tsTimerEvent tlc;             ///< Protothread, periodic operations
+    volatile uint8_t woken;       ///< Protothread, threadWake is called while thread runs
+} tsThreadSlot;
+
 /// @brief  Local continuation initialization macro
 /// @param  s Variable that keeps local continuation value
 #define LC_INIT(s) s = 0; // Initial case value
@@ -583,24 +1566,24 @@ typedef struct _tsThread
 /// @param  period Period duration in milliseconds
 /// @param  timeout Timeout duration in milliseconds
 #define PT_WAIT_UNTIL_W_PERIOD_IF_TIMEOUT(condition, period, timeout) \
-    process->tgen = (timeout);                                        \
+    thread->tgen = (timeout);                                         \
     do                                                                \
     {                                                                 \
         LC_SET(thread->lc);                                           \
         if (!(condition))                                             \
         {                                                             \
-            if (process->tgen > (period))                             \
+            if (thread->tgen > (period))                              \
             {                                                         \
-                process->tgen -= (period);                            \
+                thread->tgen -= (period);                             \
                 return (period);                                      \
             }                                                         \
             else                                                      \
             {                                                         \
-                process->tgen = 0;                                    \
+                thread->tgen = 0;                                     \
             }                                                         \
         }                                                             \
     } while (0);                                                      \
-    if (!process->tgen)
+    if (!thread->tgen)
 
 /// @brief  Block and wait while condition is true. Check it after a period and if timeout occurs run the following code block.
 /// @param  cond Condition for wait
@@ -608,7 +1591,7 @@ typedef struct _tsThread
 /// @param  timeout Timeout duration in milliseconds
 #define PT_WAIT_WHILE_W_PERIOD_IF_TIMEOUT(cond, period, timeout) PT_WAIT_UNTIL_W_PERIOD_IF_TIMEOUT(!(cond), period, timeout)
 
-/// @brief  A process can have only one protothread but that protothread can spawn a child and wait until it is finished
+/// @brief  A protothread can spawn a child and wait until it is finished
 /// @param  child Pointer to child thread
 /// @param  function Function name of the spawnling
 #define PT_SPAWN(child, function)            \
@@ -659,7 +1642,7 @@ typedef struct _tsThread
 #endif
 
 /** @brief      Used for starting a function inside a protothread that belongs to process
- *  @warning    THERE CAN BE ONLY ONE
+ *  @details    Thread runs in slot 0, see threadStartSlot for processes with several threads.
  *  @param      process Pointer to process structure that will hold the protothread information
  *  @param      threadFunction Pointer to task function that will be run during thread
  *  @retval     EXIT_FAILURE
@@ -667,14 +1650,41 @@ typedef struct _tsThread
  */
 INTERFACE uint8_t threadStart(tsProcess *process, PT_THREAD((*threadFunction)));
 
-/** @brief      Used for stopping a function inside a protothread that belongs to process
+/** @brief      Used for starting a function inside a protothread slot that belongs to process
  *  @param      process Pointer to process structure that will hold the protothread information
+ *  @param      slot Index of thread slot, 0 to threadCount of process - 1
  *  @param      threadFunction Pointer to task function that will be run during thread
- *  @retval     EXIT_FAILURE
+ *  @retval     EXIT_FAILURE Slot does not exist or it is already running a thread
+ *  @retval     EXIT_SUCCESS
+ */
+INTERFACE uint8_t threadStartSlot(tsProcess *process, uint8_t slot, PT_THREAD((*threadFunction)));
+
+/** @brief      Used for stopping a protothread, thread ends on its next call
+ *  @param      process Pointer to process structure that will hold the protothread information
+ *  @param      threadFunction Pointer to task function that is run during thread
+ *  @retval     EXIT_FAILURE No slot of process runs threadFunction
  *  @retval     EXIT_SUCCESS
  */
 INTERFACE uint8_t threadStop(tsProcess *process, PT_THREAD((*threadFunction)));
 
+/** @brief      Used for stopping the protothread of a slot, thread ends on its next call
+ *  @param      process Pointer to process structure that will hold the protothread information
+ *  @param      slot Index of thread slot
+ *  @retval     EXIT_FAILURE Slot does not exist or it is not running a thread
+ *  @retval     EXIT_SUCCESS
+ */
+INTERFACE uint8_t threadStopSlot(tsProcess *process, uint8_t slot);
+
+/** @brief      Wake the protothread of a slot that waits for a period, it is called on next tick, works in and out of ISR
+ *  @details    Used to end a wait like PT_WAIT_REQUEST early, thread checks its condition again and keeps waiting if
+ *              it is still false.
+ *  @param      process Pointer to process structure that holds the protothread information
+ *  @param      slot Index of thread slot
+ *  @retval     EXIT_FAILURE Slot does not exist or it is not running a thread
+ *  @retval     EXIT_SUCCESS
+ */
+INTERFACE uint8_t threadWake(tsProcess *process, uint8_t slot);
+
 /** @} */
 
 /** @addtogroup PROCESS
@@ -710,10 +1720,17 @@ struct _tsProcess
     uint16_t timeMaxEvent;                     ///< Event that caused maximum CPU usage
     uint16_t evCntLoad;                        ///< Current number of events in queue for this process
     uint16_t evCntMax;                         ///< Maximum number of events for one time waited in the queue
-    PT_THREAD((*threadFunction));              ///< Protothread, function
-    tsThread thread;                           ///< First thread of this process
-    tsTimerEvent tlc;                          ///< Protothread, periodic operations
-    uint32_t tgen;                             ///< Protothread, timeout operations
+    tsEventQueue *queue;                       ///< Own event queue, NULL to use the shared queue
+    uint8_t priority;                          ///< Dispatch priority of own queue, higher is served first
+    uint32_t coalesce;                         ///< EVENT_MASK of events that are not queued twice
+    uint32_t coalescePending;                  ///< EVENT_MASK of coalescable events waiting in the queue
+    uint16_t evCoalesced;                      ///< Number of posts merged into an event already waiting in the queue
+    tsEventQuota *quota;                       ///< Queue quota, NULL to reset on queue overflow
+    tsThreadSlot *threads;                     ///< Protothread slots
+    uint8_t threadCount;                       ///< Number of protothread slots
+    uint16_t budget;                           ///< Longest handler call or protothread step in ticks, 0 for budget of deadline monitor
+    uint16_t overruns;                         ///< Number of calls that exceeded budget
+    uint8_t group;                             ///< Executor group that runs process, see processAffinity
     tProcessEnum enumeration;                  ///< System-wide enumeration of event processor
     uint8_t initialized;                       ///< If this process finished initialization or not
 };
@@ -746,6 +1763,12 @@ struct _tsProcess
         _processPtr->handlerPrevious = temp;                         \
     } while (0)
 
+/// @brief  Number of event enumerations that can be coalesced, events from 0 to PROCESS_COALESCE_MAX - 1
+#define PROCESS_COALESCE_MAX (32)
+
+/// @brief  Bit of an event in coalesce masks of a process, 0 for events that cannot be coalesced
+#define EVENT_MASK(_event) (((_event) < PROCESS_COALESCE_MAX) ? ((uint32_t)1u << (_event)) : 0u)
+
 /** @brief  Macro to create a generic process object with _name
  *  @param  _name       Name of process object
  *  @param  _init       Name of initialization function
@@ -754,28 +1777,102 @@ struct _tsProcess
  *  @param  _params     Pointer to process specific parameters structure
  *  @param  _consts     Pointer to process specific constants structure
  */
-#define PROCESS_CREATE(_name, _init, _deinit, _enum, _params, _consts)   \
-    extern PROCESS_INIT_PROTO(_init);                                    \
-    extern PROCESS_DEINIT_PROTO(_deinit);                                \
-    tsProcess _name =                                                    \
-        {                                                                \
-            ._li             = LIST_DL_ITEM_INIT(),                      \
-            .init            = _init,                                    \
-            .deinit          = _deinit,                                  \
-            .handlerCurrent  = NULL,                                     \
-            .handlerPrevious = NULL,                                     \
-            .parameters      = (_params),                                \
-            .constants       = (_consts),                                \
-            .timeMax         = 0,                                        \
-            .timeMaxEvent    = 0,                                        \
-            .evCntLoad       = 0,                                        \
-            .evCntMax        = 0,                                        \
-            .threadFunction  = NULL,                                     \
-            .thread          = THREAD_INIT(),                            \
-            .tlc             = TIMER_EVENT_INIT(_enum, _enum, EVENT_PT), \
-            .tgen            = 0,                                        \
-            .enumeration     = (tProcessEnum)(_enum),                    \
-            .initialized     = 0,                                        \
+#define PROCESS_CREATE(_name, _init, _deinit, _enum, _params, _consts) \
+    PROCESS_CREATE_RAW(_name, _init, _deinit, _enum, _params, _consts, NULL, CORE_PRIORITY_DEFAULT, 0, 1, 0)
+
+/** @brief  Macro to create a process object that can run a number of protothreads at the same time
+ *  @param  _name       Name of process object
+ *  @param  _init       Name of initialization function
+ *  @param  _deinit     Name of deinitialization function
+ *  @param  _enum       System-wide process enumeration of current object
+ *  @param  _params     Pointer to process specific parameters structure
+ *  @param  _consts     Pointer to process specific constants structure
+ *  @param  _threads    Number of protothread slots, 1 to CORE_THREADS_MAX
+ */
+#define PROCESS_CREATE_THREADS(_name, _init, _deinit, _enum, _params, _consts, _threads) \
+    PROCESS_CREATE_RAW(_name, _init, _deinit, _enum, _params, _consts, NULL, CORE_PRIORITY_DEFAULT, 0, _threads, 0)
+
+/** @brief  Macro to create a process object with an execution budget, see CORE_DEADLINE_MONITOR
+ *  @param  _name       Name of process object
+ *  @param  _init       Name of initialization function
+ *  @param  _deinit     Name of deinitialization function
+ *  @param  _enum       System-wide process enumeration of current object
+ *  @param  _params     Pointer to process specific parameters structure
+ *  @param  _consts     Pointer to process specific constants structure
+ *  @param  _budget     Longest handler call or protothread step in ticks
+ */
+#define PROCESS_CREATE_BUDGET(_name, _init, _deinit, _enum, _params, _consts, _budget) \
+    PROCESS_CREATE_RAW(_name, _init, _deinit, _enum, _params, _consts, NULL, CORE_PRIORITY_DEFAULT, 0, 1, _budget)
+
+/** @brief      Macro to create a process object with coalescable events
+ *  @details    A coalescable event posted without data is dropped if the same event is already waiting in the queue
+ *              for this process, handler runs once for all of them. Use only for events whose handling does not depend
+ *              on how many times they are posted, like a screen refresh request. Dropped posts are counted in
+ *              evCoalesced.
+ *  @param      _name       Name of process object
+ *  @param      _init       Name of initialization function
+ *  @param      _deinit     Name of deinitialization function
+ *  @param      _enum       System-wide process enumeration of current object
+ *  @param      _params     Pointer to process specific parameters structure
+ *  @param      _consts     Pointer to process specific constants structure
+ *  @param      _coalesce   Events to coalesce, EVENT_MASK(event1) | EVENT_MASK(event2)...
+ */
+#define PROCESS_CREATE_COALESCE(_name, _init, _deinit, _enum, _params, _consts, _coalesce) \
+    PROCESS_CREATE_RAW(_name, _init, _deinit, _enum, _params, _consts, NULL, CORE_PRIORITY_DEFAULT, _coalesce, 1, 0)
+
+/** @brief  Macro to create a process object with its own event queue named _name##EvQue
+ *  @param  _name       Name of process object
+ *  @param  _init       Name of initialization function
+ *  @param  _deinit     Name of deinitialization function
+ *  @param  _enum       System-wide process enumeration of current object
+ *  @param  _params     Pointer to process specific parameters structure
+ *  @param  _consts     Pointer to process specific constants structure
+ *  @param  _priority   Dispatch priority, 0(CORE_PRIORITY_DEFAULT) to CORE_PRIORITY_LEVELS - 1
+ *  @param  _size       Size of event queue in bytes
+ */
+#define PROCESS_CREATE_PRIORITY(_name, _init, _deinit, _enum, _params, _consts, _priority, _size) \
+    extern tsProcess _name;                                                                       \
+    EVENT_QUEUE_CREATE(_name, &(_name), _size)                                                    \
+    PROCESS_CREATE_RAW(_name, _init, _deinit, _enum, _params, _consts, &(_name##EvQue), _priority, 0, 1, 0)
+
+/** @brief  Macro to create a process object with every option, see PROCESS_CREATE, PROCESS_CREATE_PRIORITY,
+ *          PROCESS_CREATE_COALESCE, PROCESS_CREATE_THREADS and PROCESS_CREATE_BUDGET
+ *  @param  _queuePtr   Pointer to own event queue, NULL to use the shared queue
+ *  @param  _priority   Dispatch priority of own queue
+ *  @param  _coalesce   Events to coalesce
+ *  @param  _threads    Number of protothread slots
+ *  @param  _budget     Longest handler call or protothread step in ticks, 0 for budget of deadline monitor
+ */
+#define PROCESS_CREATE_RAW(_name, _init, _deinit, _enum, _params, _consts, _queuePtr, _priority, _coalesce, _threads, _budget) \
+    extern PROCESS_INIT_PROTO(_init);                                                                                          \
+    extern PROCESS_DEINIT_PROTO(_deinit);                                                                                      \
+    tsThreadSlot _name##Threads[_threads];                                                                                     \
+    tsProcess _name =                                                                                                          \
+        {                                                                                                                      \
+            ._li             = LIST_DL_ITEM_INIT(),                                                                            \
+            .init            = _init,                                                                                          \
+            .deinit          = _deinit,                                                                                        \
+            .handlerCurrent  = NULL,                                                                                           \
+            .handlerPrevious = NULL,                                                                                           \
+            .parameters      = (_params),                                                                                      \
+            .constants       = (_consts),                                                                                      \
+            .timeMax         = 0,                                                                                              \
+            .timeMaxEvent    = 0,                                                                                              \
+            .evCntLoad       = 0,                                                                                              \
+            .evCntMax        = 0,                                                                                              \
+            .queue           = (_queuePtr),                                                                                    \
+            .priority        = (_priority),                                                                                    \
+            .coalesce        = (_coalesce),                                                                                    \
+            .coalescePending = 0,                                                                                              \
+            .evCoalesced     = 0,                                                                                              \
+            .quota           = NULL,                                                                                           \
+            .threads         = _name##Threads,                                                                                 \
+            .threadCount     = (_threads),                                                                                     \
+            .budget          = (_budget),                                                                                      \
+            .overruns        = 0,                                                                                              \
+            .group           = 0,                                                                                              \
+            .enumeration     = (tProcessEnum)(_enum),                                                                          \
+            .initialized     = 0,                                                                                              \
     };
 
 /** @brief      Start an event processor to handle events
@@ -793,11 +1890,38 @@ INTERFACE uint8_t processStart(tsProcess *process);
 INTERFACE uint8_t processStop(tsProcess *process);
 
 /** @brief  Find process object that has a matching enumeration
+ *  @details Enumerations inside the table created with CORE_PROCESS_TABLE are found with an array lookup, others are
+ *           searched in the list of started processes.
  *  @param  enumeration Enumeration of target process
  *  @return tsProcess * to target process. NULL = not present
  */
 INTERFACE tsProcess *processFind(tProcessEnum enumeration);
 
+/** @brief  Iterate started processes in start order, for diagnostics
+ *  @param  process Previous process, NULL to get the first one
+ *  @return Next started process, NULL after the last one
+ */
+INTERFACE tsProcess *processNext(const tsProcess *process);
+
+/// @brief  Table of started processes indexed by enumeration
+typedef struct
+{
+    tsProcess **entries; ///< Process of each enumeration, NULL if it is not started
+    uint16_t size;       ///< Number of entries
+} tsProcessTable;
+
+/** @brief      Used for creating the process table in main.c, processFind searches the process list without it
+ *  @details    Processes created with PROCESS_NONE take enumerations from the top of the range and stay out of a
+ *              small table.
+ *  @param      _size   Number of enumerations held by table, usually count of system process enumerations
+ */
+#define CORE_PROCESS_TABLE(_size)                                        \
+    tsProcess *rcosProcessEntries[_size];                                \
+    tsProcessTable rcosProcessTableObj = {rcosProcessEntries, (_size)}; \
+    tsProcessTable *rcosProcessTable   = &rcosProcessTableObj;
+
+INTERFACE tsProcessTable *rcosProcessTable __attribute__((weak));
+
 /** @} */
 
 /** @addtogroup WDT
@@ -842,6 +1966,438 @@ typedef struct
 extern const tsWdt rcosWdt;   /// This object must be created in main.c with CORE_WDT_CREATE macro
 extern tsWdtVars rcosWdtVars; /// This object must be created in main.c with CORE_WDT_CREATE macro
 
+/// @brief  Handler call or protothread step that ran longer than budget of its process
+typedef struct
+{
+    uint32_t tick;        ///< rcosTickCount when it was detected
+    uint16_t duration;    ///< Ticks spent, ticks spent so far for warnings
+    tProcessEnum process; ///< Process enumeration
+    tEventEnum event;     ///< Event enumeration, EVENT_PT for protothread steps
+} tsOverrun;
+
+/// @brief  Deadline monitor
+typedef struct
+{
+    tsOverrun *log;                         ///< Ring of last overruns
+    uint16_t size;                          ///< Number of entries in log
+    uint16_t head;                          ///< Next entry to write
+    uint32_t count;                         ///< Number of overruns since start
+    uint16_t budget;                        ///< Budget of processes created without one, 0 for no limit
+    tProcessEnum supervisor;                ///< Process that receives warnings, PROCESS_NONE for none
+    tEventEnum event;                       ///< Warning event, its data is a tsOverrun
+    void (*hook)(const tsOverrun *overrun); ///< Called for warnings inside rcosTickIsr, NULL for none
+} tsDeadline;
+
+/** @brief      Used for enabling the deadline monitor in main.c
+ *  @details    Each handler call and protothread step is measured against budget of its process. Calls that exceed it
+ *              are counted in overruns of process, kept in log and traced. While a call is still running, rcosTickIsr
+ *              warns once it passes the budget: hook is called at once and event is posted to supervisor, so the
+ *              stall is known before the watchdog resets the system. Budgets should be well below the watchdog period.
+ *  @param      _entries    Number of overruns kept in log
+ *  @param      _budget     Budget in ticks of processes created without one, 0 for no limit
+ *  @param      _supervisor Process that receives warnings, PROCESS_NONE for none
+ *  @param      _event      Warning event
+ *  @param      _hook       Function called inside rcosTickIsr for warnings, NULL for none
+ */
+#define CORE_DEADLINE_MONITOR(_entries, _budget, _supervisor, _event, _hook)                                  \
+    tsOverrun rcosDeadlineLog[_entries];                                                                      \
+    tsDeadline rcosDeadlineObj = {rcosDeadlineLog, (_entries), 0, 0, (_budget), (tProcessEnum)(_supervisor), \
+                                  (tEventEnum)(_event), (_hook)};                                            \
+    tsDeadline *rcosDeadline   = &rcosDeadlineObj;
+
+INTERFACE tsDeadline *rcosDeadline __attribute__((weak));
+
+/** @brief  Get an overrun from log of deadline monitor
+ *  @param  idx 0 for the latest one
+ *  @return Pointer to overrun, NULL if monitor is not created or log has less overruns
+ */
+INTERFACE const tsOverrun *deadlineOverrun(uint16_t idx);
+
+/** @} */
+
+/** @addtogroup EXECUTOR
+ *  @{
+ *  @details    Without an executor coreRun dispatches every process. CORE_EXECUTOR_CREATE adds groups, group 0 stays
+ *              on coreRun and each other group is dispatched by its own thread. A process is moved to a group with
+ *              processAffinity before it is started.
+ *              - A process runs only on the thread of its group, its handler calls still run to completion
+ *              - Posts between groups go through a lock-free ring of the destination group, the destination thread
+ *                moves them into process queues, so events of a source to a destination keep their order
+ *              - Posts from isrs, timers and the same group go directly into process queues as before
+ *              - Topic records are handled on group 0, they are forwarded to subscribers in other groups
+ *              - eventCurrent, eventData, eventBuf and eventBufLength are kept for each thread
+ *              - Deadline warnings inside rcosTickIsr are given for group 0 only, overruns are counted for all
+ *              - Watchdog is refreshed by coreRun, timers, degraded mode and replay are run on group 0
+ *              Usage:
+ *              @code
+ *                  CORE_EXECUTOR_DEFAULT(4, 4096, 256); // In main.c
+ *                  ...
+ *                  processAffinity(&processModem, 1);
+ *                  processAffinity(&processStack, 2);
+ *                  processStart(&processModem);
+ *                  processStart(&processStack);
+ *                  coreRun(); // Starts threads of groups 1 to 3
+ *              @endcode
+ */
+
+/// @brief  Ready lists of the queues of a group that have events
+typedef struct
+{
+    tsLdl list[CORE_PRIORITY_LEVELS]; ///< Queues that have events, one list for each priority
+    tsEventQueue *burstQueue;         ///< Queue served on last dispatch
+    uint32_t burst;                   ///< Number of events dispatched from burstQueue in a row
+} tsEventReady;
+
+/// @brief  Slot of ring that carries posts from other groups, same sequence scheme as isr ingress ring
+typedef struct
+{
+    uint32_t sequence;  ///< Accessed atomically
+    tsEventPost post;   ///< Event information
+    uint8_t fifo;       ///< FALSE for posts to the front of queue
+    uint8_t data[0xFF]; ///< Data of event
+} tsExecutorSlot;
+
+/// @brief  State of an executor group
+typedef struct
+{
+    tsEventReady ready;   ///< Ready lists of group
+    tsEventQueue queue;   ///< Queue of processes without own queue, eventQueue is used for group 0
+    tsExecutorSlot *ring; ///< Posts from other groups
+    uint32_t head;        ///< Next ring position to be claimed by producers, accessed atomically
+    uint32_t tail;        ///< Next ring position to be taken by thread of group
+    uint8_t sleeping;     ///< Thread waits for work, accessed atomically
+    uint32_t dispatched;  ///< Number of events dispatched by group
+    uint32_t ringFull;    ///< Number of posts dropped on a full ring, accessed atomically
+} tsExecutorGroup;
+
+/// @brief  Executor object
+typedef struct
+{
+    tsExecutorGroup *groups;                                  ///< Groups, first one is dispatched by coreRun
+    uint8_t *buffers;                                         ///< Queue buffers of groups
+    tsExecutorSlot *rings;                                    ///< Ring slots of groups
+    uint16_t queueSize;                                       ///< Size of queue buffer of each group in bytes
+    uint16_t ringSize;                                        ///< Number of slots in ring of each group
+    uint8_t count;                                            ///< Number of groups
+    void (*spawn)(void (*run)(uint8_t group), uint8_t group); ///< Start a thread that calls run for group
+    void (*wait)(uint8_t group);                              ///< Sleep until wake is called for group, called with interrupts disabled
+    void (*wake)(uint8_t group);                              ///< Wake thread of group, called with interrupts disabled
+} tsExecutor;
+
+/** @brief      Used for enabling the executor in main.c
+ *  @details    Threads are started by coreRun. Posts to another group are dropped and counted in ringFull of the
+ *              destination group when its ring is full, rings should be sized for bursts of the whole system.
+ *  @param      _groups     Number of groups including group 0 of coreRun
+ *  @param      _queueSize  Size of the queue of each group in bytes, for processes without own queue
+ *  @param      _ringSize   Number of posts that can wait in the ring of each group, must be a power of 2
+ *  @param      _spawn      Function to start a thread, void spawn(void (*run)(uint8_t group), uint8_t group)
+ *  @param      _wait       Function to sleep a thread of a group with interrupts disabled until it is woken
+ *  @param      _wake       Function to wake the thread of a group, group 0 sleeps in rcosTick.program
+ */
+#define CORE_EXECUTOR_CREATE(_groups, _queueSize, _ringSize, _spawn, _wait, _wake)                                \
+    uint8_t rcosExecutorBuffers[_groups][_queueSize];                                                             \
+    tsExecutorSlot rcosExecutorRings[_groups][_ringSize];                                                         \
+    tsExecutorGroup rcosExecutorGroups[_groups];                                                                  \
+    tsExecutor rcosExecutorObj = {rcosExecutorGroups, &rcosExecutorBuffers[0][0], &rcosExecutorRings[0][0],      \
+                                  (_queueSize), (_ringSize), (_groups), (_spawn), (_wait), (_wake)};             \
+    tsExecutor *rcosExecutor   = &rcosExecutorObj;
+
+INTERFACE tsExecutor *rcosExecutor __attribute__((weak));
+
+/** @brief  Move a process to an executor group, must be called before the process is started
+ *  @param  process Process pointer
+ *  @param  group   Executor group, 0 for coreRun
+ *  @retval EXIT_FAILURE Process is started or group does not exist
+ *  @retval EXIT_SUCCESS
+ */
+INTERFACE uint8_t processAffinity(tsProcess *process, uint8_t group);
+
+/** @} */
+
+/** @addtogroup BOOT
+ *  @{
+ *  @details    Devices in boot table are initialized by a hidden process after coreRun starts, processes in boot table
+ *              are started as soon as the devices they depend on are initialized. Slow devices do not delay the rest of
+ *              the system and the system does not wait for devices that are not needed yet.
+ *              - An init function may start a slow operation and return DEV_INIT_PENDING, it is called again on a later
+ *                step of boot process like a protothread until it returns EXIT_SUCCESS or EXIT_FAILURE
+ *              - Each step of boot process calls one init function, devices take turns
+ *              - A lazy device is initialized on its first access through dev functions, boot process skips it
+ *              - devXxInit of a device in boot table finishes its initialization at once with bootDevice, processes
+ *                started elsewhere can use boot table devices as before. A device whose init is already running returns
+ *                DEV_INIT_PENDING and a device that is still pending after CORE_BOOT_TRIES init calls fails
+ *              - A process whose dependency fails is not started
+ *              - Devices that are not in boot table count as initialized for dependencies
+ *              - Durations are measured with the cycle source of boot, see bootDump
+ *              - Devices in boot table must not be initialized before coreRun
+ *              Usage:
+ *              @code
+ *                  tsBootDevice bootDevices[] = {
+ *                      BOOT_DEV_IO(ioCapsense, NULL),
+ *                      BOOT_DEV_MEM(eeprom),
+ *                      BOOT_DEV_COM_LAZY(uartDebug),
+ *                  };
+ *                  tsBootProcess bootProcesses[] = {
+ *                      BOOT_PROCESS(processButton, &ioCapsense),
+ *                      BOOT_PROCESS(processSettings, &eeprom, &ioCapsense),
+ *                  };
+ *                  CORE_BOOT_DEFAULT(bootDevices, bootProcesses)
+ *              @endcode
+ */
+
+/// @brief  Ticks that boot process waits when every device it steps returns DEV_INIT_PENDING
+#ifndef CORE_BOOT_POLL
+#define CORE_BOOT_POLL (2)
+#endif
+
+/// @brief  Init calls that bootDevice makes for a device before it gives up and marks the device failed
+#ifndef CORE_BOOT_TRIES
+#define CORE_BOOT_TRIES (1000)
+#endif
+
+/// @brief  Kind of a boot table device
+typedef enum
+{
+    eBootDevIo = 0, ///< tsDevIo
+    eBootDevCom,    ///< tsDevCom
+    eBootDevMem,    ///< tsDevMem
+    eBootDevCpx,    ///< tsDevCpx
+} teBootDevice;
+
+/// @brief  Device entry of boot table
+typedef struct
+{
+    const void *device; ///< Device pointer of kind
+    const void *config; ///< Configuration passed to init of io and cpx devices
+    uint8_t kind;       ///< teBootDevice
+    uint8_t lazy;       ///< Initialized on first access instead of by boot process
+    uint16_t calls;     ///< Number of init calls
+    uint32_t busy;      ///< Cycles spent in init calls
+    uint32_t ready;     ///< Cycles from start of boot until init finished, 0 until then
+} tsBootDevice;
+
+/// @brief  Process entry of boot table
+typedef struct
+{
+    tsProcess *process;         ///< Process started by boot
+    const void *const *depends; ///< Devices that must be initialized before process starts, NULL items are skipped
+    uint8_t dependCount;        ///< Number of items in depends
+    uint8_t state;              ///< teDevBoot, eDevBootReady after process is started
+    uint32_t start;             ///< Cycles from start of boot until process is started
+    uint32_t busy;              ///< Cycles spent in processStart
+} tsBootProcess;
+
+/// @brief  Boot object
+typedef struct
+{
+    tsBootDevice *devices;    ///< Device table
+    uint16_t deviceCount;     ///< Number of devices
+    tsBootProcess *processes; ///< Process table
+    uint16_t processCount;    ///< Number of processes
+    uint32_t (*cycles)(void); ///< Free running cycle counter, wrap around is allowed
+    uint32_t frequency;       ///< Cycles per second
+    uint32_t start;           ///< Cycle count at start of boot
+    uint32_t done;            ///< Cycles from start of boot until every entry is finished, 0 until then
+} tsBoot;
+
+/** @brief  Boot table entry for an I/O device initialized by boot process
+ *  @param  _dev    Name of device object
+ *  @param  _config Pointer to configuration passed to init
+ */
+#define BOOT_DEV_IO(_dev, _config) \
+    {.device = &(_dev), .config = (_config), .kind = eBootDevIo, .lazy = FALSE}
+
+/** @brief  Boot table entry for an I/O device initialized on first access
+ *  @param  _dev    Name of device object
+ *  @param  _config Pointer to configuration passed to init
+ */
+#define BOOT_DEV_IO_LAZY(_dev, _config) \
+    {.device = &(_dev), .config = (_config), .kind = eBootDevIo, .lazy = TRUE}
+
+/** @brief  Boot table entry for a communication device initialized by boot process
+ *  @param  _dev    Name of device object
+ */
+#define BOOT_DEV_COM(_dev) \
+    {.device = &(_dev), .config = NULL, .kind = eBootDevCom, .lazy = FALSE}
+
+/** @brief  Boot table entry for a communication device initialized on first access
+ *  @param  _dev    Name of device object
+ */
+#define BOOT_DEV_COM_LAZY(_dev) \
+    {.device = &(_dev), .config = NULL, .kind = eBootDevCom, .lazy = TRUE}
+
+/** @brief  Boot table entry for a memory device initialized by boot process
+ *  @param  _dev    Name of device object
+ */
+#define BOOT_DEV_MEM(_dev) \
+    {.device = &(_dev), .config = NULL, .kind = eBootDevMem, .lazy = FALSE}
+
+/** @brief  Boot table entry for a memory device initialized on first access
+ *  @param  _dev    Name of device object
+ */
+#define BOOT_DEV_MEM_LAZY(_dev) \
+    {.device = &(_dev), .config = NULL, .kind = eBootDevMem, .lazy = TRUE}
+
+/** @brief  Boot table entry for a complex device initialized by boot process
+ *  @param  _dev    Name of device object
+ *  @param  _config Pointer to configuration passed to init
+ */
+#define BOOT_DEV_CPX(_dev, _config) \
+    {.device = &(_dev), .config = (_config), .kind = eBootDevCpx, .lazy = FALSE}
+
+/** @brief  Boot table entry for a process
+ *  @param  _process    Name of process object
+ *  @param  ...         Pointers of devices that process depends on, NULL if there is none
+ */
+#define BOOT_PROCESS(_process, ...)                                                       \
+    {                                                                                     \
+        .process     = &(_process),                                                       \
+        .depends     = (const void *const[]){__VA_ARGS__},                                \
+        .dependCount = sizeof((const void *const[]){__VA_ARGS__}) / sizeof(const void *), \
+    }
+
+/** @brief      Used for enabling boot in main.c
+ *  @details    Platforms supply CORE_BOOT_DEFAULT with their own cycle source.
+ *  @param      _devices    Array of tsBootDevice entries
+ *  @param      _processes  Array of tsBootProcess entries
+ *  @param      _cycles     Function returning a free running cycle counter
+ *  @param      _frequency  Frequency of cycle counter in Hz
+ */
+#define CORE_BOOT_CREATE(_devices, _processes, _cycles, _frequency)                               \
+    tsBoot rcosBootObj = {(_devices), ARRAY_SIZE(_devices), (_processes), ARRAY_SIZE(_processes), \
+                          (_cycles), (_frequency), 0, 0};                                         \
+    tsBoot *rcosBoot   = &rcosBootObj;
+
+INTERFACE tsBoot *rcosBoot __attribute__((weak));
+
+/** @brief  Finish initialization of a boot table device at once
+ *  @details Init function is called until it does not return DEV_INIT_PENDING, at most CORE_BOOT_TRIES times. Called
+ *           by dev functions for lazy devices and by devXxInit, an initialized device returns at once. A device whose
+ *           init returned DEV_INIT_PENDING before is left to boot process, this also stops an init function that
+ *           initializes its own device from recursing.
+ *  @param  device  Device pointer of any kind
+ *  @retval EXIT_FAILURE        Device is not in boot table, its init failed or did not finish in CORE_BOOT_TRIES calls
+ *  @retval EXIT_SUCCESS
+ *  @retval DEV_INIT_PENDING    Init of device is in progress
+ */
+INTERFACE uint8_t bootDevice(const void *device);
+
+/** @brief  Print boot durations in json format
+ *  @details Output is an object with frequency, done and arrays of devices and processes. Devices have their index in
+ *           boot table, kind, state, calls, busy and ready items, processes have process, state, start and busy items.
+ *           Durations are in cycles of frequency.
+ *  @param  print   printf like function used as json stream
+ */
+INTERFACE void bootDump(int (*print)(const char *format, ...));
+
+/** @} */
+
+/** @addtogroup WATERMARK
+ *  @{
+ *  @details    Stack and registered buffers are painted with CORE_WATERMARK_PAINT when coreRun starts, highest
+ *              usage is found later by searching for the first byte that is not paint. Deques and event queues keep
+ *              their largest load themselves, so they are reported without painting.
+ *              - Buffers are expected to be filled from their start, usage is the offset of last changed byte + 1
+ *              - Data bytes equal to paint at the end of a buffer or stack are counted as unused
+ *              - A buffer cleared by its user after coreRun shows as fully used
+ *              - Stack of coreRun is painted by the platform below the frame of coreRun, frames above it are in use
+ *              Usage:
+ *              @code
+ *                  tsWatermarkArea watermarkAreas[] = {
+ *                      WATERMARK_BUFFER("scSpiFrame", scSpiParams.frame.data),
+ *                      WATERMARK_DEQUE("uartTx", uartTxFifo),
+ *                  };
+ *                  CORE_WATERMARK_DEFAULT(watermarkAreas)
+ *              @endcode
+ */
+
+/// @brief  Byte written to unused stack and registered buffers
+#ifndef CORE_WATERMARK_PAINT
+#define CORE_WATERMARK_PAINT (0xA5u)
+#endif
+
+/// @brief  Kind of a watched RAM area
+typedef enum
+{
+    eWatermarkStack = 0, ///< Stack of coreRun
+    eWatermarkQueue,     ///< Event queue, shared one or own queue of a process
+    eWatermarkBuffer,    ///< Painted buffer
+    eWatermarkDeque,     ///< tsDeque
+} teWatermarkKind;
+
+/// @brief  RAM area registered for high-water reports
+typedef struct
+{
+    const char *name; ///< Name used in reports
+    void *area;       ///< Start of buffer or tsDeque pointer
+    uint16_t size;    ///< Size of buffer in bytes, not used for deques
+    uint8_t kind;     ///< eWatermarkBuffer or eWatermarkDeque
+} tsWatermarkArea;
+
+/// @brief  Watermark object
+typedef struct
+{
+    tsWatermarkArea *areas;                 ///< Registered areas
+    uint16_t count;                         ///< Number of registered areas
+    uint32_t (*stackPaint)(uint8_t **base); ///< Paints unused stack, returns its size and lowest address, NULL for no stack
+    uint8_t *stack;                         ///< Lowest address of painted stack
+    uint32_t stackSize;                     ///< Size of painted stack
+} tsWatermark;
+
+/// @brief  High-water mark of an area
+typedef struct
+{
+    const char *name;     ///< Name of area
+    uint8_t kind;         ///< teWatermarkKind
+    tProcessEnum process; ///< Process of own event queue, PROCESS_NONE for other areas
+    uint32_t size;        ///< Size in bytes, painted part for stack
+    uint32_t peak;        ///< Largest number of bytes used
+    uint16_t events;      ///< Largest number of events waited in an event queue, evCntMax
+    uint8_t signals;      ///< Largest number of events waited in signal ring of an event queue
+} tsWatermarkMark;
+
+/** @brief  Register a buffer that is painted, usually a protocol frame or a driver buffer
+ *  @param  _name   Name used in reports
+ *  @param  _buffer Array, its size is taken with sizeof
+ */
+#define WATERMARK_BUFFER(_name, _buffer) \
+    {.name = (_name), .area = (_buffer), .size = sizeof(_buffer), .kind = eWatermarkBuffer}
+
+/** @brief  Register a deque
+ *  @param  _name   Name used in reports
+ *  @param  _deque  tsDeque object
+ */
+#define WATERMARK_DEQUE(_name, _deque) \
+    {.name = (_name), .area = &(_deque), .size = 0, .kind = eWatermarkDeque}
+
+/** @brief      Used for enabling high-water reports in main.c
+ *  @details    Platforms supply CORE_WATERMARK_DEFAULT with their own stack painter.
+ *  @param      _areas      Array of tsWatermarkArea entries
+ *  @param      _stackPaint Function that paints unused stack with CORE_WATERMARK_PAINT, NULL to skip stack
+ */
+#define CORE_WATERMARK_CREATE(_areas, _stackPaint)                                         \
+    tsWatermark rcosWatermarkObj = {(_areas), ARRAY_SIZE(_areas), (_stackPaint), NULL, 0}; \
+    tsWatermark *rcosWatermark   = &rcosWatermarkObj;
+
+INTERFACE tsWatermark *rcosWatermark __attribute__((weak));
+
+/** @brief  Get high-water mark of an area
+ *  @details Areas are in order of stack, shared event queue, own queues of started processes and registered areas.
+ *           Stack and registered areas are reported only when CORE_WATERMARK_CREATE is used.
+ *  @param  idx     Index of area
+ *  @param  mark    High-water mark of area
+ *  @retval EXIT_FAILURE There is no area with idx
+ *  @retval EXIT_SUCCESS
+ */
+INTERFACE uint8_t watermarkGet(uint16_t idx, tsWatermarkMark *mark);
+
+/** @brief  Print all high-water marks in json format
+ *  @details Output is an array of objects with name, kind, size and peak items, event queues have process, events and
+ *           signals items too.
+ *  @param  print   printf like function used as json stream
+ */
+INTERFACE void watermarkDump(int (*print)(const char *format, ...));
+
 /** @} */
 
 #if CORE_INTERCOM
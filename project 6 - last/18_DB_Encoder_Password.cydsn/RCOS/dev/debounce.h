@@ -62,20 +62,20 @@ typedef struct
  *  @param  _period     Duration of each period to check array of devIo
  *  @param  ...         Debounce items' initial values created by @ref DEBOUNCE_ITEM
  */
-#define DEV_CPX_DEBOUNCE_CREATE(_name, _period, ...)               \
-    extern TIMER_CALLBACK_FUNC(debounceCheck);                     \
-    const tsDevCpx _name;                                          \
-    tsDebounceItem _name##List[] =                                 \
-        {                                                          \
-            __VA_ARGS__,                                           \
-    };                                                             \
-    tsDebounceParams _name##Params =                               \
-        {                                                          \
-            .timer   = TIMER_CALLBACK_INIT(debounceCheck, &_name), \
-            .ioList  = _name##List,                                \
-            .ioCount = ARRAY_SIZE(_name##List),                    \
-            .period  = (_period),                                  \
-    };                                                             \
+#define DEV_CPX_DEBOUNCE_CREATE(_name, _period, ...)                        \
+    extern TIMER_CALLBACK_FUNC(debounceCheck);                              \
+    const tsDevCpx _name;                                                   \
+    tsDebounceItem _name##List[] =                                          \
+        {                                                                   \
+            __VA_ARGS__,                                                    \
+    };                                                                      \
+    tsDebounceParams _name##Params =                                        \
+        {                                                                   \
+            .timer   = TIMER_CALLBACK_INIT_DEFERRED(debounceCheck, &_name), \
+            .ioList  = _name##List,                                         \
+            .ioCount = ARRAY_SIZE(_name##List),                             \
+            .period  = (_period),                                           \
+    };                                                                      \
     DEV_CPX_CREATE(_name, devCpxDebounceFuncs, &_name##Params, NULL)
 
 /// @brief  Functions for DEBOUNCE input devices
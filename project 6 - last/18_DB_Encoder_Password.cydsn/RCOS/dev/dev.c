@@ -0,0 +1,809 @@
+/** @file       dev.c
+ *  @brief      Abstract device driver functions
+ *  @copyright  (c) 2018-Arcelik - All Rights Reserved
+ *              Permission to use, reproduce, copy, prepare derivative works,
+ *              modify, distribute, perform, display or sell this software and/or
+ *              its documentation for any purpose is prohibited without the express
+ *              written consent of Arcelik A.S.
+ *  @date       17.10.2026
+ */
+#define FILE_DEV_C
+
+#include "rcos.h"
+#include "libs/json.h"
+#include <stdio.h>
+
+/// @brief  Size of the buffer used to format devComPrint texts
+#define DEV_COM_PRINT_BUFFER_SIZE (256)
+
+/// @brief  Check if a device has the target function
+#define DEV_HAS_FUNC(_devicePtr, _func) \
+    ((_devicePtr) && (_devicePtr)->functions && (_devicePtr)->functions->_func)
+
+/// @brief  Finish initialization of a device that boot initializes on its first access
+#define DEV_BOOT_LAZY(_devicePtr)                    \
+    do                                               \
+    {                                                \
+        if (eDevBootLazy == (_devicePtr)->sys->boot) \
+        {                                            \
+            bootDevice(_devicePtr);                  \
+        }                                            \
+    } while (0)
+
+/** @brief  Call init function of a device, or let boot finish it for a device in boot table
+ *  @details Init function that still returns DEV_INIT_PENDING after CORE_BOOT_TRIES calls fails, like in bootDevice.
+ *  @param  _devicePtr  Pointer to device
+ *  @param  ...         Arguments of init function
+ */
+#define DEV_INIT(_devicePtr, ...)                                             \
+    do                                                                        \
+    {                                                                         \
+        uint16_t tries = 0;                                                   \
+        uint8_t result;                                                       \
+                                                                              \
+        if (eDevBootNone != (_devicePtr)->sys->boot)                          \
+        {                                                                     \
+            return bootDevice(_devicePtr);                                    \
+        }                                                                     \
+        do                                                                    \
+        {                                                                     \
+            result = (_devicePtr)->functions->init(__VA_ARGS__);              \
+        } while ((DEV_INIT_PENDING == result) && (++tries < CORE_BOOT_TRIES)); \
+        return (DEV_INIT_PENDING == result) ? EXIT_FAILURE : result;          \
+    } while (0)
+
+/** @brief  Fill a request and mark it busy
+ *  @return EXIT_FAILURE if request is busy, empty or its completion cannot reach the caller
+ */
+static uint8_t devRequestBegin(tsDevRequest *request, teDevOp op, uint32_t address, const void *data, uint32_t length, tTicket ticket, uint8_t event)
+{
+    if ((NULL == request) || (0 == length) || (eDevRequestBusy == request->state) || (eDevRequestWaiting == request->state))
+    {
+        return EXIT_FAILURE;
+    }
+    if ((EVENT_PT == event) && ((EVENT_PT != eventCurrent.event) || (eventCurrent.source != eventCurrent.destination)))
+    {
+        return EXIT_FAILURE; // Only a protothread can sleep until completion
+    }
+
+    request->data    = (void *)data;
+    request->address = address;
+    request->length  = length;
+    request->done    = 0;
+    request->ticket  = ticket;
+    request->op      = op;
+    request->process = eventCurrent.destination;
+    request->event   = event;
+    request->slot    = EVENT_SLOT(eventCurrent.flags);
+    request->status  = EXIT_FAILURE;
+    request->state   = eDevRequestBusy;
+
+    return EXIT_SUCCESS;
+}
+
+#if DEV_ASYNC
+/** @brief  Pass a filled request to async function of driver
+ *  @return EXIT_FAILURE if driver rejected it
+ */
+#define DEV_REQUEST_START(_devicePtr, _request)                                   \
+    do                                                                            \
+    {                                                                             \
+        DEV_BOOT_LAZY(_devicePtr);                                                \
+        if (EXIT_SUCCESS != (_devicePtr)->functions->async(_devicePtr, _request)) \
+        {                                                                         \
+            (_request)->state = eDevRequestIdle;                                  \
+            return EXIT_FAILURE;                                                  \
+        }                                                                         \
+        return EXIT_SUCCESS;                                                      \
+    } while (0)
+#endif
+
+uint8_t devRequestComplete(tsDevRequest *request, uint8_t status, uint32_t done)
+{
+    tsDevCompletion completion;
+    uint8_t state;
+
+    globalIntDisable();
+    state           = request->state;
+    request->status = status;
+    request->done   = done;
+    request->state  = eDevRequestDone;
+    globalIntEnable();
+
+    if ((eDevRequestBusy != state) && (eDevRequestWaiting != state))
+    {
+        return EXIT_FAILURE;
+    }
+
+    if (EVENT_PT == request->event)
+    {
+        if (eDevRequestWaiting == state)
+        {
+            return threadWake(processFind(request->process), request->slot);
+        }
+        return EXIT_SUCCESS; // Thread finds it done when it reaches PT_WAIT_REQUEST
+    }
+
+    completion.done   = done;
+    completion.ticket = request->ticket;
+    completion.op     = request->op;
+    completion.status = status;
+
+    if (TRUE == isIsrActive())
+    {
+        return eventPostFromIsr(request->process, request->event, &completion, sizeof(completion));
+    }
+
+    return eventPost(request->process, request->event, &completion, sizeof(completion));
+}
+
+teBool devRequestWait(tsDevRequest *request)
+{
+    teBool done = TRUE;
+
+    globalIntDisable();
+    if ((eDevRequestBusy == request->state) || (eDevRequestWaiting == request->state))
+    {
+        request->state = eDevRequestWaiting; // Completion wakes the thread from now on
+        done           = FALSE;
+    }
+    globalIntEnable();
+
+    return done;
+}
+
+/// @brief  Waiting class of a ticket after starvation protection
+static uint8_t tvmClass(const tsTvmQueue *queue, const tsTvmWaiter *waiter, uint32_t now)
+{
+    uint32_t steps;
+
+    if (0 == queue->aging)
+    {
+        return waiter->prio;
+    }
+
+    steps = (now - waiter->since) / queue->aging;
+
+    return (steps >= waiter->prio) ? eTicketUrgent : (uint8_t)(waiter->prio - steps);
+}
+
+/// @brief  Add wait time of a ticket that is up to statistics of its class
+static void tvmStat(tsTvmQueue *queue, uint8_t prio, uint32_t waited)
+{
+    tsTvmStats *stats = &queue->stats[prio];
+
+    stats->count++;
+    stats->total += waited;
+    stats->max = MAX(stats->max, waited);
+}
+
+tTicket tvmGet(tsTvm *tvm, uint8_t prio, uint8_t event)
+{
+    tsTvmQueue *queue = TVM_QUEUE_OF(*tvm);
+    tsTvmWaiter *waiter;
+    tTicket ticket;
+
+    if (NULL == queue)
+    {
+        return tvm->next++; // First come first served
+    }
+
+    prio = MIN(prio, eTicketClasses - 1);
+    if ((PROCESS_NONE == eventCurrent.destination) || (TRUE == isIsrActive()) ||
+        ((EVENT_PT == event) && ((EVENT_PT != eventCurrent.event) || (eventCurrent.source != eventCurrent.destination))))
+    {
+        event = EVENT_NONE; // No handler or protothread of its own to wake, holder checks with TICKET_IS_UP
+    }
+
+    globalIntDisable();
+    ticket = tvm->next++;
+    if (ticket == tvm->current)
+    {
+        tvmStat(queue, prio, 0); // Nobody holds it, ticket is up at once
+    }
+    else if ((0 == queue->overflowCount) && (queue->count < queue->size))
+    {
+        waiter          = &queue->waiters[queue->count++];
+        waiter->since   = rcosTickCount();
+        waiter->ticket  = ticket;
+        waiter->prio    = prio;
+        waiter->process = eventCurrent.destination;
+        waiter->event   = event;
+        waiter->slot    = EVENT_SLOT(eventCurrent.flags);
+    }
+    else
+    {
+        if (0 == queue->overflowCount)
+        {
+            queue->overflowFirst = ticket;
+        }
+        queue->overflowCount++; // Tickets go on in order until they are all up, a waiter is never lost
+        queue->overflows++;
+    }
+    globalIntEnable();
+
+    return ticket;
+}
+
+uint32_t tvmWaitPeriod(const tsTvm *tvm, tTicket ticket)
+{
+    const tsTvmQueue *queue = TVM_QUEUE_OF(*tvm);
+    const tsTvmWaiter *waiter;
+    uint32_t period         = PT_WAITING; // Nobody wakes a ticket that is not listed for the calling protothread
+    uint8_t idx;
+
+    if (NULL == queue)
+    {
+        return PT_WAITING;
+    }
+
+    globalIntDisable();
+    for (idx = 0; idx < queue->count; idx++)
+    {
+        waiter = &queue->waiters[idx];
+        if (waiter->ticket == ticket)
+        {
+            if ((EVENT_PT == waiter->event) && (eventCurrent.destination == waiter->process) && (EVENT_SLOT(eventCurrent.flags) == waiter->slot))
+            {
+                period = CORE_TIMER_PERIOD_MAX;
+            }
+            break;
+        }
+    }
+    globalIntEnable();
+
+    return period;
+}
+
+void tvmRemove(tsTvm *tvm)
+{
+    tsTvmQueue *queue = TVM_QUEUE_OF(*tvm);
+    tsTvmWaiter up    = {0};
+    uint32_t now      = rcosTickCount();
+    uint8_t best      = 0;
+    uint8_t bestClass = eTicketClasses;
+    uint8_t waiterClass;
+    uint8_t idx;
+
+    if (NULL == queue)
+    {
+        if (tvm->current != tvm->next)
+        {
+            tvm->current++;
+        }
+        return;
+    }
+
+    globalIntDisable();
+    for (idx = 0; idx < queue->count; idx++)
+    {
+        waiterClass = tvmClass(queue, &queue->waiters[idx], now);
+        if ((waiterClass < bestClass) ||
+            ((waiterClass == bestClass) && ((int16_t)(tTicket)(queue->waiters[idx].ticket - queue->waiters[best].ticket) < 0)))
+        {
+            best      = idx;
+            bestClass = waiterClass;
+        }
+    }
+
+    if (queue->count)
+    {
+        up                   = queue->waiters[best];
+        queue->waiters[best] = queue->waiters[--queue->count]; // Order is kept by ticket numbers
+        tvm->current         = up.ticket;
+        tvmStat(queue, up.prio, now - up.since);
+        if (bestClass < up.prio)
+        {
+            queue->stats[up.prio].promoted++;
+        }
+    }
+    else if (queue->overflowCount)
+    {
+        tvm->current = queue->overflowFirst++;
+        queue->overflowCount--;
+    }
+    else
+    {
+        tvm->current = tvm->next; // Nobody waits, next ticket is up at once
+    }
+    globalIntEnable();
+
+    if (EVENT_PT == up.event)
+    {
+        threadWake(processFind(up.process), up.slot);
+    }
+    else if (EVENT_NONE == up.event)
+    {
+        // Holder checks with TICKET_IS_UP
+    }
+    else if (TRUE == isIsrActive())
+    {
+        eventPostFromIsr(up.process, up.event, &up.ticket, sizeof(up.ticket));
+    }
+    else
+    {
+        eventPost(up.process, up.event, &up.ticket, sizeof(up.ticket));
+    }
+}
+
+void tvmDump(const tsTvm *tvm, int (*print)(const char *format, ...))
+{
+    const tsTvmQueue *queue = TVM_QUEUE_OF(*tvm);
+    const tsTvmStats *stats;
+    uint8_t prio;
+
+    jsonInit(print);
+    jsonObjOpen(NULL);
+    jsonNumber("current", tvm->current);
+    jsonNumber("next", tvm->next);
+    if (queue)
+    {
+        jsonNumber("waiting", queue->count);
+        jsonNumber("overflows", queue->overflows);
+        jsonArrOpen("classes");
+        for (prio = 0; prio < eTicketClasses; prio++)
+        {
+            stats = &queue->stats[prio];
+            jsonObjOpen(NULL);
+            jsonNumber("count", stats->count);
+            jsonNumber("mean", stats->count ? (stats->total / stats->count) : 0);
+            jsonNumber("max", stats->max);
+            jsonNumber("promoted", stats->promoted);
+            jsonObjClose();
+        }
+        jsonArrClose();
+    }
+    jsonObjClose();
+}
+
+/** @addtogroup DEV_IO
+ *  @{
+ */
+
+DEV_IO_FUNC_INIT(devIoInit)
+{
+    if (DEV_HAS_FUNC(device, init))
+    {
+        DEV_INIT(device, device, config);
+    }
+
+    return EXIT_FAILURE;
+}
+
+DEV_IO_FUNC_DEINIT(devIoDeinit)
+{
+    if (DEV_HAS_FUNC(device, deinit))
+    {
+        device->sys->boot = eDevBootNone; // Init after deinit is called directly
+        return device->functions->deinit(device);
+    }
+
+    return EXIT_FAILURE;
+}
+
+DEV_IO_FUNC_GET(devIoGet)
+{
+    uint32_t data   = 0;
+    uint16_t length = sizeof(data);
+
+    if (rcosRecorder && (TRUE == replayInput(eRecordIoGet, device, &data, &length)))
+    {
+        return data;
+    }
+
+    if (DEV_HAS_FUNC(device, get))
+    {
+        DEV_BOOT_LAZY(device);
+        data = device->functions->get(device);
+        if (rcosRecorder)
+        {
+            recordInput(eRecordIoGet, device, &data, sizeof(data));
+        }
+    }
+
+    return data;
+}
+
+DEV_IO_FUNC_PUT(devIoPut)
+{
+    if (DEV_HAS_FUNC(device, put))
+    {
+        DEV_BOOT_LAZY(device);
+        return device->functions->put(device, data);
+    }
+
+    return EXIT_FAILURE;
+}
+
+/** @} */
+
+/** @addtogroup DEV_COM
+ *  @{
+ */
+
+DEV_COM_FUNC_INIT(devComInit)
+{
+    if (DEV_HAS_FUNC(device, init))
+    {
+        DEV_INIT(device, device);
+    }
+
+    return EXIT_FAILURE;
+}
+
+DEV_COM_FUNC_DEINIT(devComDeinit)
+{
+    if (DEV_HAS_FUNC(device, deinit))
+    {
+        device->sys->boot = eDevBootNone; // Init after deinit is called directly
+        return device->functions->deinit(device);
+    }
+
+    return EXIT_FAILURE;
+}
+
+DEV_COM_FUNC_OPEN(devComOpen)
+{
+    if (DEV_HAS_FUNC(device, open))
+    {
+        DEV_BOOT_LAZY(device);
+        return device->functions->open(device, target);
+    }
+
+    return EXIT_FAILURE;
+}
+
+DEV_COM_FUNC_CLOSE(devComClose)
+{
+    if (DEV_HAS_FUNC(device, close))
+    {
+        return device->functions->close(device, target);
+    }
+
+    return EXIT_FAILURE;
+}
+
+DEV_COM_FUNC_SEND(devComSend)
+{
+    if (DEV_HAS_FUNC(device, send))
+    {
+        DEV_BOOT_LAZY(device);
+        return device->functions->send(device, txb, length);
+    }
+
+    return 0;
+}
+
+DEV_COM_FUNC_RECEIVE(devComReceive)
+{
+    uint16_t received = length;
+
+    if (rcosRecorder && (TRUE == replayInput(eRecordComReceive, device, rxb, &received)))
+    {
+        return received;
+    }
+
+    if (DEV_HAS_FUNC(device, receive))
+    {
+        DEV_BOOT_LAZY(device);
+        received = device->functions->receive(device, rxb, length);
+        if (rcosRecorder && length)
+        {
+            recordInput(eRecordComReceive, device, rxb, received);
+        }
+        return received;
+    }
+
+    return 0;
+}
+
+DEV_COM_FUNC_TICKET_GET(devComTicketGet)
+{
+    if (DEV_HAS_FUNC(device, ticketGet))
+    {
+        DEV_BOOT_LAZY(device);
+        return device->functions->ticketGet(device);
+    }
+
+    DEV_COM_FUNC_TICKET_GET_GENERIC(device)
+}
+
+tTicket devComTicketGetPriority(const tsDevCom *device, uint8_t prio, uint8_t event)
+{
+    DEV_BOOT_LAZY(device);
+
+    return tvmGet(&device->sys->tvm, prio, event);
+}
+
+DEV_COM_FUNC_TICKET_VALID(devComTicketValid)
+{
+    if (DEV_HAS_FUNC(device, ticketValid))
+    {
+        return device->functions->ticketValid(device, ticket);
+    }
+
+    DEV_COM_FUNC_TICKET_VALID_GENERIC(device)
+
+    return FALSE;
+}
+
+/** @brief  Start a filled communication request, drivers without async function run it at once
+ *  @return EXIT_FAILURE if driver rejected it or its completion could not be posted
+ */
+static uint8_t devComAsync(const tsDevCom *device, tsDevRequest *request)
+{
+    uint16_t done;
+
+#if DEV_ASYNC
+    if (DEV_HAS_FUNC(device, async))
+    {
+        DEV_REQUEST_START(device, request);
+    }
+#endif
+
+    if (eDevOpSend == request->op)
+    {
+        done = devComSend(device, request->data, (uint16_t)request->length);
+    }
+    else
+    {
+        done = devComReceive(device, request->data, (uint16_t)request->length); // Recorded and replayed like a synchronous receive
+    }
+
+    return devRequestComplete(request, (done == request->length) ? EXIT_SUCCESS : EXIT_FAILURE, done);
+}
+
+uint8_t devComSendAsync(const tsDevCom *device, tsDevRequest *request, const void *txb, uint16_t length, tTicket ticket, uint8_t event)
+{
+    if (EXIT_SUCCESS != devRequestBegin(request, eDevOpSend, 0, txb, length, ticket, event))
+    {
+        return EXIT_FAILURE;
+    }
+
+    return devComAsync(device, request);
+}
+
+uint8_t devComReceiveAsync(const tsDevCom *device, tsDevRequest *request, void *rxb, uint16_t length, tTicket ticket, uint8_t event)
+{
+    if (EXIT_SUCCESS != devRequestBegin(request, eDevOpReceive, 0, rxb, length, ticket, event))
+    {
+        return EXIT_FAILURE;
+    }
+
+    return devComAsync(device, request);
+}
+
+uint16_t devComPrint(const tsDevCom *device, const char *format, ...)
+{
+    uint16_t length;
+    va_list args;
+
+    va_start(args, format);
+    length = _devComVPrint(device, format, args);
+    va_end(args);
+
+    return length;
+}
+
+uint16_t _devComVPrint(const tsDevCom *device, const char *format, va_list args)
+{
+    char buffer[DEV_COM_PRINT_BUFFER_SIZE];
+    int length;
+
+    length = vsnprintf(buffer, sizeof(buffer), format, args);
+    if (length <= 0)
+    {
+        return 0;
+    }
+
+    return devComSend(device, buffer, (uint16_t)MIN((uint32_t)length, sizeof(buffer) - 1));
+}
+
+/** @} */
+
+/** @addtogroup DEV_MEM
+ *  @{
+ */
+
+DEV_MEM_FUNC_INIT(devMemInit)
+{
+    if (DEV_HAS_FUNC(device, init))
+    {
+        DEV_INIT(device, device);
+    }
+
+    return EXIT_FAILURE;
+}
+
+DEV_MEM_FUNC_DEINIT(devMemDeinit)
+{
+    if (DEV_HAS_FUNC(device, deinit))
+    {
+        device->sys->boot = eDevBootNone; // Init after deinit is called directly
+        return device->functions->deinit(device);
+    }
+
+    return EXIT_FAILURE;
+}
+
+DEV_MEM_FUNC_READ(devMemRead)
+{
+    if (DEV_HAS_FUNC(device, read))
+    {
+        DEV_BOOT_LAZY(device);
+        return device->functions->read(device, address, readData, length);
+    }
+
+    return EXIT_FAILURE;
+}
+
+DEV_MEM_FUNC_WRITE(devMemWrite)
+{
+    if (DEV_HAS_FUNC(device, write))
+    {
+        DEV_BOOT_LAZY(device);
+        return device->functions->write(device, address, writeData, length);
+    }
+
+    return EXIT_FAILURE;
+}
+
+DEV_MEM_FUNC_PROGRAM(devMemProgram)
+{
+    if (DEV_HAS_FUNC(device, program))
+    {
+        DEV_BOOT_LAZY(device);
+        return device->functions->program(device, address, progData, length);
+    }
+
+    return EXIT_FAILURE;
+}
+
+DEV_MEM_FUNC_ERASE(devMemErase)
+{
+    if (DEV_HAS_FUNC(device, erase))
+    {
+        DEV_BOOT_LAZY(device);
+        return device->functions->erase(device, address, size);
+    }
+
+    return 0;
+}
+
+DEV_MEM_FUNC_TICKET_GET(devMemTicketGet)
+{
+    if (DEV_HAS_FUNC(device, ticketGet))
+    {
+        DEV_BOOT_LAZY(device);
+        return device->functions->ticketGet(device);
+    }
+
+    DEV_MEM_FUNC_TICKET_GET_GENERIC(device)
+}
+
+tTicket devMemTicketGetPriority(const tsDevMem *device, uint8_t prio, uint8_t event)
+{
+    DEV_BOOT_LAZY(device);
+
+    return tvmGet(&device->sys->tvm, prio, event);
+}
+
+DEV_MEM_FUNC_TICKET_VALID(devMemTicketValid)
+{
+    if (DEV_HAS_FUNC(device, ticketValid))
+    {
+        return device->functions->ticketValid(device, ticket);
+    }
+
+    DEV_MEM_FUNC_TICKET_VALID_GENERIC(device)
+
+    return FALSE;
+}
+
+/** @brief  Start a filled memory request, drivers without async function run it at once
+ *  @return EXIT_FAILURE if driver rejected it or its completion could not be posted
+ */
+static uint8_t devMemAsync(const tsDevMem *device, tsDevRequest *request)
+{
+    uint32_t done;
+    uint8_t status;
+
+#if DEV_ASYNC
+    if (DEV_HAS_FUNC(device, async))
+    {
+        DEV_REQUEST_START(device, request);
+    }
+#endif
+
+    switch (request->op)
+    {
+    case eDevOpRead:
+        status = devMemRead(device, request->address, request->data, (uint16_t)request->length);
+        break;
+    case eDevOpWrite:
+        status = devMemWrite(device, request->address, request->data, (uint16_t)request->length);
+        break;
+    case eDevOpProgram:
+        status = devMemProgram(device, request->address, request->data, (uint16_t)request->length);
+        break;
+    default:
+        done = devMemErase(device, request->address, request->length); // Only erase returns a size
+        return devRequestComplete(request, (done == request->length) ? EXIT_SUCCESS : EXIT_FAILURE, done);
+    }
+
+    return devRequestComplete(request, status, (EXIT_SUCCESS == status) ? request->length : 0);
+}
+
+uint8_t devMemReadAsync(const tsDevMem *device, tsDevRequest *request, uint32_t address, void *readData, uint16_t length, tTicket ticket, uint8_t event)
+{
+    if (EXIT_SUCCESS != devRequestBegin(request, eDevOpRead, address, readData, length, ticket, event))
+    {
+        return EXIT_FAILURE;
+    }
+
+    return devMemAsync(device, request);
+}
+
+uint8_t devMemWriteAsync(const tsDevMem *device, tsDevRequest *request, uint32_t address, const void *writeData, uint16_t length, tTicket ticket, uint8_t event)
+{
+    if (EXIT_SUCCESS != devRequestBegin(request, eDevOpWrite, address, writeData, length, ticket, event))
+    {
+        return EXIT_FAILURE;
+    }
+
+    return devMemAsync(device, request);
+}
+
+uint8_t devMemProgramAsync(const tsDevMem *device, tsDevRequest *request, uint32_t address, const void *progData, uint16_t length, tTicket ticket, uint8_t event)
+{
+    if (EXIT_SUCCESS != devRequestBegin(request, eDevOpProgram, address, progData, length, ticket, event))
+    {
+        return EXIT_FAILURE;
+    }
+
+    return devMemAsync(device, request);
+}
+
+uint8_t devMemEraseAsync(const tsDevMem *device, tsDevRequest *request, uint32_t address, uint32_t size, tTicket ticket, uint8_t event)
+{
+    if (EXIT_SUCCESS != devRequestBegin(request, eDevOpErase, address, NULL, size, ticket, event))
+    {
+        return EXIT_FAILURE;
+    }
+
+    return devMemAsync(device, request);
+}
+
+/** @} */
+
+/** @addtogroup DEV_CPX
+ *  @{
+ */
+
+DEV_CPX_FUNC_INIT(devCpxInit)
+{
+    if (DEV_HAS_FUNC(device, init))
+    {
+        DEV_INIT(device, device, config);
+    }
+
+    return EXIT_FAILURE;
+}
+
+DEV_CPX_FUNC_DEINIT(devCpxDeinit)
+{
+    if (DEV_HAS_FUNC(device, deinit))
+    {
+        device->sys->boot = eDevBootNone; // Init after deinit is called directly
+        return device->functions->deinit(device);
+    }
+
+    return EXIT_FAILURE;
+}
+
+/** @} */
+
+void addDevVersion()
+{
+    ADD_RCOS_VERSION("dev", "1.0.0")
+}
@@ -37,12 +37,162 @@
  *      @}
  *  @}
  */
+/// @brief  Returned by init functions that started a slow operation and must be called again to finish, see BOOT
+#define DEV_INIT_PENDING (2)
+
+/** @brief      Async functions of communication and memory drivers, 0 keeps their function tables as they were before
+ *  @details    A project that links drivers of a prebuilt platform archive sets it to 0, async requests then always
+ *              run synchronously and complete before they return.
+ */
+#ifndef DEV_ASYNC
+#define DEV_ASYNC (1)
+#endif
+
+/// @brief  Initialization state of a device kept in its system values, set by BOOT
+typedef enum
+{
+    eDevBootNone = 0, ///< Not in boot table, init functions are called directly
+    eDevBootLazy,     ///< Initialized on first access
+    eDevBootPending,  ///< Waiting for boot process
+    eDevBootBusy,     ///< Init function returned DEV_INIT_PENDING, it is called again
+    eDevBootReady,    ///< Init function succeeded
+    eDevBootFailed,   ///< Init function failed
+} teDevBoot;
+
+/// @brief  Operation of an asynchronous request
+typedef enum
+{
+    eDevOpSend = 0, ///< devComSendAsync
+    eDevOpReceive,  ///< devComReceiveAsync
+    eDevOpRead,     ///< devMemReadAsync
+    eDevOpWrite,    ///< devMemWriteAsync
+    eDevOpProgram,  ///< devMemProgramAsync
+    eDevOpErase,    ///< devMemEraseAsync
+} teDevOp;
+
+/// @brief  State of an asynchronous request
+typedef enum
+{
+    eDevRequestIdle = 0, ///< Never started or rejected by device
+    eDevRequestBusy,     ///< Accepted by device, completion is waited
+    eDevRequestWaiting,  ///< Busy and its protothread sleeps until completion
+    eDevRequestDone,     ///< Completed, status and done are valid
+} teDevRequest;
+
+/** @brief      Asynchronous request to a communication or memory device
+ *  @details    Request is kept by the requester until it completes, driver keeps a pointer to it and finishes it with
+ *              devRequestComplete. Completion is posted to the requesting process as the event given with the request
+ *              and carries a tsDevCompletion. When the event is EVENT_PT, the requesting protothread that sleeps in
+ *              PT_WAIT_REQUEST is woken instead.
+ *  @warning    Do not change a busy request or the buffer it points to
+ */
+typedef struct
+{
+    void *data;             ///< Buffer of operation, transmitted data is not changed
+    uint32_t address;       ///< Memory address, unused by devCom
+    uint32_t length;        ///< Requested length or erase size
+    uint32_t done;          ///< Bytes transferred or erased when completed
+    tTicket ticket;         ///< Ticket request is made with, returned with completion
+    uint8_t op;             ///< teDevOp
+    uint8_t process;        ///< tProcessEnum of requesting process
+    uint8_t event;          ///< tEventEnum of completion
+    uint8_t slot;           ///< Protothread slot of requester when event is EVENT_PT
+    uint8_t status;         ///< EXIT_SUCCESS or EXIT_FAILURE when completed
+    volatile uint8_t state; ///< teDevRequest
+} tsDevRequest;
+
+/// @brief  Data of completion event of an asynchronous request, fits into an isr posted event
+typedef struct
+{
+    uint32_t done;  ///< Bytes transferred or erased
+    tTicket ticket; ///< Ticket of request
+    uint8_t op;     ///< teDevOp
+    uint8_t status; ///< EXIT_SUCCESS when all of requested length is done, EXIT_FAILURE otherwise
+} tsDevCompletion;
+
+/// @brief  Initial value of a tsDevRequest
+#define DEV_REQUEST_INIT() {0}
+
 #ifndef FILE_DEV_C
 #define INTERFACE extern
 #else
 #define INTERFACE
 #endif
 
+/** @brief      Finish an asynchronous request and post its completion, used by drivers and works in and out of ISR
+ *  @param      request Request given to async function of driver
+ *  @param      status  EXIT_SUCCESS or EXIT_FAILURE
+ *  @param      done    Bytes transferred or erased
+ *  @retval     EXIT_FAILURE Request is not busy or its completion could not be posted, state is done anyway
+ *  @retval     EXIT_SUCCESS
+ */
+INTERFACE uint8_t devRequestComplete(tsDevRequest *request, uint8_t status, uint32_t done);
+
+/** @brief      Check if a request is completed, a busy request is marked so that its completion wakes the protothread
+ *  @param      request Request
+ *  @return     TRUE if request is not busy
+ */
+INTERFACE teBool devRequestWait(tsDevRequest *request);
+
+/** @brief      Sleep in a protothread until an asynchronous request made with EVENT_PT completes
+ *  @details    Thread is not called again until driver finishes the request with devRequestComplete, there is no
+ *              polling. Usage:
+ *              @code
+ *                  static tsDevRequest request;
+ *
+ *                  PT_WAIT_UNTIL(devMemTicketValid(&eeprom, ticket));
+ *                  if (EXIT_SUCCESS == devMemReadAsync(&eeprom, &request, 0x10, buffer, 32, ticket, EVENT_PT))
+ *                  {
+ *                      PT_WAIT_REQUEST(&request);
+ *                      // request.status and request.done hold the result
+ *                  }
+ *              @endcode
+ *  @warning    Driver must complete every request it has accepted, otherwise the thread sleeps forever
+ *  @param      request Pointer to request
+ */
+#define PT_WAIT_REQUEST(request) PT_WAIT_UNTIL_W_PERIOD(devRequestWait(request), CORE_TIMER_PERIOD_MAX)
+
+/** @brief      Get a ticket of a priority class from a ticket vending machine, see TICKET
+ *  @details    Without a queue the ticket is the next number and class and event are not used. With a queue, holder
+ *              is woken with event when its ticket is up and wait time is added to statistics of its class.
+ *              Outside handlers, in an isr or with EVENT_PT outside a protothread, there is nobody to wake and event
+ *              is taken as EVENT_NONE.
+ *  @param      tvm     Ticket vending machine
+ *  @param      prio    teTicketClass
+ *  @param      event   tEventEnum posted to calling process with the tTicket when it is up, EVENT_PT wakes calling
+ *                      protothread, EVENT_NONE to check with TICKET_IS_UP
+ *  @return     Ticket
+ */
+INTERFACE tTicket tvmGet(tsTvm *tvm, uint8_t prio, uint8_t event);
+
+/** @brief      Remove current ticket of a ticket vending machine that has a queue, used by TICKET_REMOVE
+ *  @details    Waiting ticket of the lowest class is up, a ticket goes one class up for each aging period it waits.
+ *              Oldest ticket is up among the same class. Works in and out of ISR.
+ *  @param      tvm     Ticket vending machine
+ */
+INTERFACE void tvmRemove(tsTvm *tvm);
+
+/** @brief      Print state and wait time statistics of each class of a ticket vending machine in json format
+ *  @param      tvm     Ticket vending machine
+ *  @param      print   printf like function that prints the text
+ */
+INTERFACE void tvmDump(const tsTvm *tvm, int (*print)(const char *format, ...));
+
+/** @brief      Wait period of a protothread for a ticket, used by PT_WAIT_TICKET
+ *  @param      tvm     Ticket vending machine
+ *  @param      ticket  Ticket
+ *  @return     CORE_TIMER_PERIOD_MAX when ticket waits in queue taken with EVENT_PT by calling protothread so that
+ *              tvmRemove wakes it, PT_WAITING to check on each call otherwise
+ */
+INTERFACE uint32_t tvmWaitPeriod(const tsTvm *tvm, tTicket ticket);
+
+/** @brief      Sleep in a protothread until a ticket taken with EVENT_PT is up
+ *  @details    Without a queue, or for a ticket that did not fit into the queue, it is checked on each call.
+ *  @param      _tvm    Ticket vending machine
+ *  @param      _ticket Ticket
+ */
+#define PT_WAIT_TICKET(_tvm, _ticket) PT_WAIT_UNTIL_W_PERIOD(TICKET_IS_UP(_tvm, _ticket), tvmWaitPeriod(&(_tvm), _ticket))
+
 /**
  *  @addtogroup DEV_IO
  *  @{
@@ -73,6 +223,7 @@ typedef struct _tsDevIoFuncs
 typedef struct _tsDevIoSystem
 {
     uint8_t initialized; ///< Device initialized flag
+    uint8_t boot;        ///< teDevBoot
 } tsDevIoSystem;
 
 struct _tsDevIo
@@ -100,10 +251,13 @@ struct _tsDevIo
             .sys        = &_name##Sys,                            \
     };
 
-/** @brief  Initialize an I/O device with a pointer to device specific configuration structure
- *  @param  device I/O device pointer
- *  @param  config pointer to device specific configuration structure
- *  @return EXIT_FAILURE or EXIT_SUCCESS
+/** @brief      Initialize an I/O device with a pointer to device specific configuration structure
+ *  @details    Init function is called again while it returns DEV_INIT_PENDING, at most CORE_BOOT_TRIES times, then
+ *              initialization fails. For a device in boot table, its initialization is finished with bootDevice and
+ *              config of boot table is used instead.
+ *  @param      device I/O device pointer
+ *  @param      config pointer to device specific configuration structure
+ *  @return     EXIT_FAILURE or EXIT_SUCCESS
  */
 INTERFACE DEV_IO_FUNC_INIT(devIoInit);
 
@@ -155,6 +309,8 @@ typedef struct _tsTarget tsTarget;
 #define DEV_COM_FUNC_TICKET_GET(_name) tTicket _name(const tsDevCom *device)
 /// @brief  DEV_COM ticket check function prototype
 #define DEV_COM_FUNC_TICKET_VALID(_name) teBool _name(const tsDevCom *device, tTicket ticket)
+/// @brief  DEV_COM asynchronous request function prototype
+#define DEV_COM_FUNC_ASYNC(_name) uint8_t _name(const tsDevCom *device, tsDevRequest *request)
 
 /// @brief  Generic functions required from communication devices
 typedef struct _tsDevComFuncs
@@ -167,6 +323,9 @@ typedef struct _tsDevComFuncs
     DEV_COM_FUNC_RECEIVE((*receive));          ///< Receive data from last opened target
     DEV_COM_FUNC_TICKET_GET((*ticketGet));     ///< Get a ticket from com device
     DEV_COM_FUNC_TICKET_VALID((*ticketValid)); ///< Check if ticket is valid for an operation
+#if DEV_ASYNC
+    DEV_COM_FUNC_ASYNC((*async));              ///< Start an asynchronous request, optional
+#endif
 } tsDevComFuncs;
 
 /// @brief  Communication device system control mechanisms
@@ -176,6 +335,7 @@ typedef struct _tsDevComSystem
     uint8_t initialized; ///< Device initialized flag
     tsTarget *opened;    ///< Currently open target
     tsTarget *closed;    ///< Target that is ready for closure
+    uint8_t boot;        ///< teDevBoot
 } tsDevComSystem;
 
 /// @brief  Communication device abstraction object structure
@@ -195,7 +355,7 @@ struct _tsDevCom
  *  @param      _constsPtr      Pointer to constants object that will be used for this device
  */
 #define DEV_COM_CREATE(_name, _devComFuncs, _paramsPtr, _constsPtr) \
-    tsDevComSystem _name##Sys = {TVM_INIT(), 0, 0, 0};              \
+    tsDevComSystem _name##Sys = {TVM_INIT(), 0, 0, 0, 0};           \
     const tsDevCom _name =                                          \
         {                                                           \
             .functions  = &_devComFuncs,                            \
@@ -204,9 +364,11 @@ struct _tsDevCom
             .sys        = &_name##Sys,                              \
     };
 
-/** @brief  Initialize a communication device
- *  @param  device communication device pointer
- *  @return EXIT_FAILURE or EXIT_SUCCESS
+/** @brief      Initialize a communication device
+ *  @details    Init function is called again while it returns DEV_INIT_PENDING, at most CORE_BOOT_TRIES times, then
+ *              initialization fails. For a device in boot table, its initialization is finished with bootDevice.
+ *  @param      device communication device pointer
+ *  @return     EXIT_FAILURE or EXIT_SUCCESS
  */
 INTERFACE DEV_COM_FUNC_INIT(devComInit);
 
@@ -254,6 +416,14 @@ INTERFACE DEV_COM_FUNC_RECEIVE(devComReceive);
  */
 INTERFACE DEV_COM_FUNC_TICKET_GET(devComTicketGet);
 
+/** @brief  Get a ticket of a priority class from communication device, see tvmGet
+ *  @param  device  communication device pointer
+ *  @param  prio    teTicketClass
+ *  @param  event   tEventEnum posted to calling process when ticket is up, EVENT_PT wakes calling protothread
+ *  @return Ticket value with type tTicket
+ */
+INTERFACE tTicket devComTicketGetPriority(const tsDevCom *device, uint8_t prio, uint8_t event);
+
 /** @brief  Generic devComTicketGet function
  *  @param  _devicePtr Pointer to device
  */
@@ -284,6 +454,35 @@ INTERFACE DEV_COM_FUNC_TICKET_VALID(devComTicketValid);
         }                                                      \
     }
 
+/** @brief      Start sending data to last opened target without waiting for it
+ *  @details    Request is made while ticket is valid, like devComSend. Driver posts the completion when all data is
+ *              sent. Drivers without async function send at once and the completion is posted before returning, a
+ *              partial send completes with EXIT_FAILURE.
+ *  @param      device  Communication device pointer
+ *  @param      request Request kept until completion, see tsDevRequest
+ *  @param      txb     Pointer to data, kept until completion
+ *  @param      length  Length of data
+ *  @param      ticket  Ticket returned with completion
+ *  @param      event   Completion tEventEnum posted to calling process, EVENT_PT to wake calling protothread
+ *  @retval     EXIT_FAILURE Request is busy, device rejected it or its completion could not be posted
+ *  @retval     EXIT_SUCCESS Completion will follow
+ */
+INTERFACE uint8_t devComSendAsync(const tsDevCom *device, tsDevRequest *request, const void *txb, uint16_t length, tTicket ticket, uint8_t event);
+
+/** @brief      Start receiving data from last opened target without waiting for it
+ *  @details    Driver posts the completion when requested length is received. Drivers without async function
+ *              complete at once with data that was already received, see devComSendAsync.
+ *  @param      device  Communication device pointer
+ *  @param      request Request kept until completion, see tsDevRequest
+ *  @param      rxb     Pointer to buffer that received data is placed, kept until completion
+ *  @param      length  Length of data
+ *  @param      ticket  Ticket returned with completion
+ *  @param      event   Completion tEventEnum posted to calling process, EVENT_PT to wake calling protothread
+ *  @retval     EXIT_FAILURE Request is busy, device rejected it or its completion could not be posted
+ *  @retval     EXIT_SUCCESS Completion will follow
+ */
+INTERFACE uint8_t devComReceiveAsync(const tsDevCom *device, tsDevRequest *request, void *rxb, uint16_t length, tTicket ticket, uint8_t event);
+
 /** @brief      Send a formatted text through com device
  *  @warning    Result text is limited to 256 bytes
  *  @param      device Communication device pointer
@@ -343,6 +542,8 @@ typedef struct _tsDevMem tsDevMem; ///< Abstract device object for memory device
 #define DEV_MEM_FUNC_TICKET_GET(_name) tTicket _name(const tsDevMem *device)
 /// @brief  DEV_MEM ticket validation function prototype
 #define DEV_MEM_FUNC_TICKET_VALID(_name) teBool _name(const tsDevMem *device, tTicket ticket)
+/// @brief  DEV_MEM asynchronous request function prototype
+#define DEV_MEM_FUNC_ASYNC(_name) uint8_t _name(const tsDevMem *device, tsDevRequest *request)
 
 /// @brief  Generic functions required from memory devices
 typedef struct _tsDevMemFuncs
@@ -355,6 +556,9 @@ typedef struct _tsDevMemFuncs
     DEV_MEM_FUNC_ERASE((*erase));              ///< Erase target area
     DEV_MEM_FUNC_TICKET_GET((*ticketGet));     ///< Get a new ticket
     DEV_MEM_FUNC_TICKET_VALID((*ticketValid)); ///< Check if ticket is valid for an operation
+#if DEV_ASYNC
+    DEV_MEM_FUNC_ASYNC((*async));              ///< Start an asynchronous request, optional
+#endif
 } tsDevMemFuncs;
 
 /// @brief  Memory device system control mechanisms
@@ -362,6 +566,7 @@ typedef struct _tsDevMemSystem
 {
     tsTvm tvm;           ///< Ticket Vending Machine
     uint8_t initialized; ///< Device initialized flag
+    uint8_t boot;        ///< teDevBoot
 } tsDevMemSystem;
 
 struct _tsDevMem
@@ -389,9 +594,11 @@ struct _tsDevMem
             .sys        = &_name##Sys,                              \
     };
 
-/** @brief  Initialize a memory device
- *  @param  device memory device pointer
- *  @return EXIT_FAILURE or EXIT_SUCCESS
+/** @brief      Initialize a memory device
+ *  @details    Init function is called again while it returns DEV_INIT_PENDING, at most CORE_BOOT_TRIES times, then
+ *              initialization fails. For a device in boot table, its initialization is finished with bootDevice.
+ *  @param      device memory device pointer
+ *  @return     EXIT_FAILURE or EXIT_SUCCESS
  */
 INTERFACE DEV_MEM_FUNC_INIT(devMemInit);
 
@@ -442,6 +649,14 @@ INTERFACE DEV_MEM_FUNC_ERASE(devMemErase);
  */
 INTERFACE DEV_MEM_FUNC_TICKET_GET(devMemTicketGet);
 
+/** @brief  Get a ticket of a priority class from memory device, see tvmGet
+ *  @param  device  memory device pointer
+ *  @param  prio    teTicketClass
+ *  @param  event   tEventEnum posted to calling process when ticket is up, EVENT_PT wakes calling protothread
+ *  @return Ticket value with type tTicket
+ */
+INTERFACE tTicket devMemTicketGetPriority(const tsDevMem *device, uint8_t prio, uint8_t event);
+
 /** @brief  Generic deMemTicketGet function
  *  @param  _devicePtr Pointer to device
  */
@@ -472,6 +687,59 @@ INTERFACE DEV_MEM_FUNC_TICKET_VALID(devMemTicketValid);
         }                                                      \
     }
 
+/** @brief      Start reading data from address on memory device without waiting for it
+ *  @details    Request is made while ticket is valid, like devMemRead. Driver posts the completion when the operation
+ *              finishes. Drivers without async function read at once and the completion is posted before returning.
+ *  @param      device      Memory device pointer
+ *  @param      request     Request kept until completion, see tsDevRequest
+ *  @param      address     Memory address
+ *  @param      readData    Pointer to buffer to read data into, kept until completion
+ *  @param      length      Length of data to read
+ *  @param      ticket      Ticket returned with completion
+ *  @param      event       Completion tEventEnum posted to calling process, EVENT_PT to wake calling protothread
+ *  @retval     EXIT_FAILURE Request is busy, device rejected it or its completion could not be posted
+ *  @retval     EXIT_SUCCESS Completion will follow
+ */
+INTERFACE uint8_t devMemReadAsync(const tsDevMem *device, tsDevRequest *request, uint32_t address, void *readData, uint16_t length, tTicket ticket, uint8_t event);
+
+/** @brief      Start writing data to address on memory device without waiting for it, see devMemReadAsync
+ *  @param      device      Memory device pointer
+ *  @param      request     Request kept until completion, see tsDevRequest
+ *  @param      address     Memory address
+ *  @param      writeData   Pointer to data, kept until completion
+ *  @param      length      Length of data to write
+ *  @param      ticket      Ticket returned with completion
+ *  @param      event       Completion tEventEnum posted to calling process, EVENT_PT to wake calling protothread
+ *  @retval     EXIT_FAILURE Request is busy, device rejected it or its completion could not be posted
+ *  @retval     EXIT_SUCCESS Completion will follow
+ */
+INTERFACE uint8_t devMemWriteAsync(const tsDevMem *device, tsDevRequest *request, uint32_t address, const void *writeData, uint16_t length, tTicket ticket, uint8_t event);
+
+/** @brief      Start programming data to address on memory device without waiting for it, see devMemReadAsync
+ *  @param      device      Memory device pointer
+ *  @param      request     Request kept until completion, see tsDevRequest
+ *  @param      address     Memory address
+ *  @param      progData    Pointer to data, kept until completion
+ *  @param      length      Length of data to program
+ *  @param      ticket      Ticket returned with completion
+ *  @param      event       Completion tEventEnum posted to calling process, EVENT_PT to wake calling protothread
+ *  @retval     EXIT_FAILURE Request is busy, device rejected it or its completion could not be posted
+ *  @retval     EXIT_SUCCESS Completion will follow
+ */
+INTERFACE uint8_t devMemProgramAsync(const tsDevMem *device, tsDevRequest *request, uint32_t address, const void *progData, uint16_t length, tTicket ticket, uint8_t event);
+
+/** @brief      Start erasing target area on memory device without waiting for it, see devMemReadAsync
+ *  @param      device      Memory device pointer
+ *  @param      request     Request kept until completion, see tsDevRequest
+ *  @param      address     Memory address
+ *  @param      size        Size of area
+ *  @param      ticket      Ticket returned with completion
+ *  @param      event       Completion tEventEnum posted to calling process, EVENT_PT to wake calling protothread
+ *  @retval     EXIT_FAILURE Request is busy, device rejected it or its completion could not be posted
+ *  @retval     EXIT_SUCCESS Completion will follow
+ */
+INTERFACE uint8_t devMemEraseAsync(const tsDevMem *device, tsDevRequest *request, uint32_t address, uint32_t size, tTicket ticket, uint8_t event);
+
 /** @} */
 
 /**
@@ -499,6 +767,7 @@ typedef struct _tsDevCpxSystem
 {
     tsTvm tvm;           ///< Ticket Vending Machine
     uint8_t initialized; ///< Device initialized flag
+    uint8_t boot;        ///< teDevBoot
 } tsDevCpxSystem;
 
 struct _tsDevCpx
@@ -526,10 +795,13 @@ struct _tsDevCpx
             .sys        = &_name##Sys,                              \
     };
 
-/** @brief  Initialize a complex device
- *  @param  device complex device pointer
- *  @param  config pointer to device specific configuration structure
- *  @return EXIT_FAILURE or EXIT_SUCCESS
+/** @brief      Initialize a complex device
+ *  @details    Init function is called again while it returns DEV_INIT_PENDING, at most CORE_BOOT_TRIES times, then
+ *              initialization fails. For a device in boot table, its initialization is finished with bootDevice and
+ *              config of boot table is used instead.
+ *  @param      device complex device pointer
+ *  @param      config pointer to device specific configuration structure
+ *  @return     EXIT_FAILURE or EXIT_SUCCESS
  */
 INTERFACE DEV_CPX_FUNC_INIT(devCpxInit);
 
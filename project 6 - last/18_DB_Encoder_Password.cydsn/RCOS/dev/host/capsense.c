@@ -0,0 +1,85 @@
+/** @file       host/capsense.c
+ *  @brief      Capacitive sensing buttons emulated on POSIX hosts
+ *  @copyright  (c) 2026-Arcelik - All Rights Reserved
+ *              Permission to use, reproduce, copy, prepare derivative works,
+ *              modify, distribute, perform, display or sell this software and/or
+ *              its documentation for any purpose is prohibited without the express
+ *              written consent of Arcelik A.S.
+ *  @date       17.10.2026
+ */
+#define FILE_CAPSENSE_C
+
+#include "capsense.h"
+
+/** @addtogroup HOST_CAPSENSE
+ *  @{
+ */
+
+static DEV_IO_FUNC_INIT(capsenseInit);
+static DEV_IO_FUNC_DEINIT(capsenseDeinit);
+static DEV_IO_FUNC_GET(capsenseGet);
+static DEV_IO_FUNC_PUT(capsensePut);
+
+/// @brief  Structure that defines the functions for capsense
+const tsDevIoFuncs devIoCapsenseFuncs =
+{
+    capsenseInit,
+    capsenseDeinit,
+    capsenseGet,
+    capsensePut,
+};
+
+/// @brief  Init function for a capsense
+static DEV_IO_FUNC_INIT(capsenseInit)
+{
+    tsCapsenseParams *params = device->parameters;
+
+    UNUSED(config);
+
+    ADD_RCOS_VERSION("host/capsense", "1.0.0")
+
+    params->sensors          = 0;
+    device->sys->initialized = 1;
+
+    return EXIT_SUCCESS;
+}
+
+/// @brief  Deinit function for a capsense
+static DEV_IO_FUNC_DEINIT(capsenseDeinit)
+{
+    device->sys->initialized = 0;
+
+    return EXIT_SUCCESS;
+}
+
+/// @brief  Get function for a capsense
+/// @return Active widgets
+static DEV_IO_FUNC_GET(capsenseGet)
+{
+    const tsCapsenseParams *params = device->parameters;
+
+    if (!device->sys->initialized)
+    {
+        return 0;
+    }
+
+    return params->sensors;
+}
+
+/// @brief  Put function for a capsense, not supported
+static DEV_IO_FUNC_PUT(capsensePut)
+{
+    UNUSED(device);
+    UNUSED(data);
+
+    return EXIT_FAILURE;
+}
+
+void hostCapsenseSet(const tsDevIo *device, uint32_t sensors)
+{
+    tsCapsenseParams *params = device->parameters;
+
+    params->sensors = sensors;
+}
+
+/** @} */
@@ -0,0 +1,71 @@
+/** @file       host/capsense.h
+ *  @brief      Capacitive sensing buttons emulated on POSIX hosts
+ *  @copyright  (c) 2026-Arcelik - All Rights Reserved
+ *              Permission to use, reproduce, copy, prepare derivative works,
+ *              modify, distribute, perform, display or sell this software and/or
+ *              its documentation for any purpose is prohibited without the express
+ *              written consent of Arcelik A.S.
+ *  @date       17.10.2026
+ */
+#ifndef FILE_CAPSENSE_H
+#define FILE_CAPSENSE_H
+
+#include "rcos.h"
+
+/**
+ *  @defgroup   HOST_CAPSENSE CAPSENSE
+ *  @ingroup    HOST_DEV_IO
+ *  @brief      Emulated capacitive sensing buttons, each bit of the value is a widget
+ *  @{
+ */
+
+#ifndef FILE_CAPSENSE_C
+#define INTERFACE extern
+#else
+#define INTERFACE
+#endif
+
+/// @brief  Functions for CAPSENSE devices
+INTERFACE const tsDevIoFuncs devIoCapsenseFuncs;
+
+/// @brief  Device specific constants
+typedef struct
+{
+    const char *name;      ///< Name of the module on target board
+    uint8_t totalScanTime; ///< Total scan time of all widgets, kept for compatibility with other platforms
+} tsCapsenseConsts;
+
+/// @brief  Device specific parameters
+typedef struct
+{
+    volatile uint32_t sensors; ///< Active widgets, bit 0 is widget 0
+} tsCapsenseParams;
+
+/** @brief  Create a CAPSENSE devIo
+ *  @param  _name           Name of devIo object
+ *  @param  _cyName         Name of the module on target board
+ *  @param  _totalScanTime  Total scan time of all widgets in milliseconds
+ */
+#define DEV_IO_CAPSENSE_CREATE(_name, _cyName, _totalScanTime) \
+    const tsCapsenseConsts _name##Consts =                     \
+        {                                                      \
+            #_cyName,                                          \
+            (_totalScanTime),                                  \
+    };                                                         \
+    tsCapsenseParams _name##Params =                           \
+        {                                                      \
+            0,                                                 \
+    };                                                         \
+    DEV_IO_CREATE(_name, devIoCapsenseFuncs, &_name##Params, &_name##Consts)
+
+/** @brief  Touch or release widgets from outside(test harness, simulated hardware)
+ *  @param  device  CAPSENSE device
+ *  @param  sensors Active widgets, bit 0 is widget 0
+ */
+INTERFACE void hostCapsenseSet(const tsDevIo *device, uint32_t sensors);
+
+#undef INTERFACE // Should not let this roam free
+
+/** @} */
+
+#endif // FILE_CAPSENSE_H
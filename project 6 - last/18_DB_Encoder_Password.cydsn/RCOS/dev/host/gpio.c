@@ -0,0 +1,81 @@
+/** @file       host/gpio.c
+ *  @brief      General Purpose I/O device driver emulated on POSIX hosts
+ *  @copyright  (c) 2026-Arcelik - All Rights Reserved
+ *              Permission to use, reproduce, copy, prepare derivative works,
+ *              modify, distribute, perform, display or sell this software and/or
+ *              its documentation for any purpose is prohibited without the express
+ *              written consent of Arcelik A.S.
+ *  @date       17.10.2026
+ */
+#define FILE_GPIO_C
+
+#include "gpio.h"
+
+/** @addtogroup HOST_GPIO
+ *  @{
+ */
+
+static DEV_IO_FUNC_INIT(gpioInit);
+static DEV_IO_FUNC_DEINIT(gpioDeinit);
+static DEV_IO_FUNC_GET(gpioGet);
+static DEV_IO_FUNC_PUT(gpioPut);
+
+/// @brief  Structure that defines the functions for gpio
+const tsDevIoFuncs devIoGpioFuncs =
+{
+    gpioInit,
+    gpioDeinit,
+    gpioGet,
+    gpioPut,
+};
+
+/// @brief  Init function for a gpio
+static DEV_IO_FUNC_INIT(gpioInit)
+{
+    UNUSED(config);
+
+    ADD_RCOS_VERSION("host/gpio", "1.0.0")
+
+    device->sys->initialized = 1;
+
+    return EXIT_SUCCESS;
+}
+
+/// @brief  Deinit function for a gpio
+static DEV_IO_FUNC_DEINIT(gpioDeinit)
+{
+    device->sys->initialized = 0;
+
+    return EXIT_SUCCESS;
+}
+
+/// @brief  Get function for a gpio
+/// @return 1: active, 0: passive
+static DEV_IO_FUNC_GET(gpioGet)
+{
+    const tsGpioParams *params = device->parameters;
+    const tsGpioConsts *consts = device->constants;
+
+    return (params->level == consts->active) ? 1 : 0;
+}
+
+/// @brief  Put function for a gpio
+/// @param  data    0: passive, others: active
+static DEV_IO_FUNC_PUT(gpioPut)
+{
+    tsGpioParams *params       = device->parameters;
+    const tsGpioConsts *consts = device->constants;
+
+    params->level = data ? consts->active : !consts->active;
+
+    return EXIT_SUCCESS;
+}
+
+void hostGpioSet(const tsDevIo *device, uint8_t level)
+{
+    tsGpioParams *params = device->parameters;
+
+    params->level = level ? 1 : 0;
+}
+
+/** @} */
@@ -0,0 +1,71 @@
+/** @file       host/gpio.h
+ *  @brief      General Purpose I/O device driver emulated on POSIX hosts
+ *  @copyright  (c) 2026-Arcelik - All Rights Reserved
+ *              Permission to use, reproduce, copy, prepare derivative works,
+ *              modify, distribute, perform, display or sell this software and/or
+ *              its documentation for any purpose is prohibited without the express
+ *              written consent of Arcelik A.S.
+ *  @date       17.10.2026
+ */
+#ifndef FILE_GPIO_H
+#define FILE_GPIO_H
+
+#include "rcos.h"
+
+/**
+ *  @defgroup   HOST_GPIO GPIO
+ *  @ingroup    HOST_DEV_IO
+ *  @brief      Emulated General Purpose I/O, pin level is kept in memory
+ *  @{
+ */
+
+#ifndef FILE_GPIO_C
+#define INTERFACE extern
+#else
+#define INTERFACE
+#endif
+
+/// @brief  Functions for GPIO devices
+INTERFACE const tsDevIoFuncs devIoGpioFuncs;
+
+/// @brief  Device specific parameters
+typedef struct
+{
+    uint8_t level; ///< Electrical level of the pin
+} tsGpioParams;
+
+/// @brief  Device specific constants
+typedef struct
+{
+    const char *name; ///< Name of the pin on target board
+    uint8_t active;   ///< Activity level of the pin 0: low, 1: high
+} tsGpioConsts;
+
+/** @brief  Create a GPIO object
+ *  @param  _name   Name of devIo object
+ *  @param  _cyName Name of the pin on target board, kept for compatibility with other platforms
+ *  @param  _active Active level for this GPIO(0:active low, 1:active high)
+ */
+#define DEV_IO_GPIO_CREATE(_name, _cyName, _active) \
+    tsGpioParams _name##Params =                    \
+        {                                           \
+            (_active) ? 0 : 1,                      \
+    };                                              \
+    const tsGpioConsts _name##Consts =              \
+        {                                           \
+            #_cyName,                               \
+            (_active) ? 1 : 0,                      \
+    };                                              \
+    DEV_IO_CREATE(_name, devIoGpioFuncs, &_name##Params, &_name##Consts)
+
+/** @brief  Drive the electrical level of a pin from outside(test harness, simulated hardware)
+ *  @param  device  GPIO device
+ *  @param  level   Electrical level of the pin
+ */
+INTERFACE void hostGpioSet(const tsDevIo *device, uint8_t level);
+
+#undef INTERFACE // Should not let this roam free
+
+/** @} */
+
+#endif // FILE_GPIO_H
@@ -0,0 +1,148 @@
+/** @file       host/memfile.c
+ *  @brief      Memory device kept in a file of POSIX hosts
+ *  @copyright  (c) 2026-Arcelik - All Rights Reserved
+ *              Permission to use, reproduce, copy, prepare derivative works,
+ *              modify, distribute, perform, display or sell this software and/or
+ *              its documentation for any purpose is prohibited without the express
+ *              written consent of Arcelik A.S.
+ *  @date       17.10.2026
+ */
+#define FILE_MEMFILE_C
+
+#include "memfile.h"
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+
+/** @addtogroup HOST_MEMFILE
+ *  @{
+ */
+
+/// @brief  Size of buffer used to erase an area
+#define MEMFILE_ERASE_CHUNK (256)
+
+static DEV_MEM_FUNC_INIT(memfileInit);
+static DEV_MEM_FUNC_DEINIT(memfileDeinit);
+static DEV_MEM_FUNC_READ(memfileRead);
+static DEV_MEM_FUNC_WRITE(memfileWrite);
+static DEV_MEM_FUNC_ERASE(memfileErase);
+
+/// @brief  Structure that defines the functions for memfile
+const tsDevMemFuncs devMemMemfileFuncs =
+{
+    memfileInit,
+    memfileDeinit,
+    memfileRead,
+    memfileWrite,
+    memfileWrite,
+    memfileErase,
+    NULL,
+    NULL,
+};
+
+/// @brief  Length of an access that fits into memory
+static uint16_t memfileFit(const tsDevMem *device, uint32_t address, uint16_t length)
+{
+    const tsMemfileConsts *consts = device->constants;
+    const tsMemfileParams *params = device->parameters;
+
+    if (!device->sys->initialized || (params->fd < 0) || (address >= consts->size))
+    {
+        return 0;
+    }
+
+    return (uint16_t)MIN((uint32_t)length, consts->size - address);
+}
+
+/// @brief  Init function for a memfile, opens or creates the file
+static DEV_MEM_FUNC_INIT(memfileInit)
+{
+    const tsMemfileConsts *consts = device->constants;
+    tsMemfileParams *params       = device->parameters;
+
+    ADD_RCOS_VERSION("host/memfile", "1.0.0")
+
+    params->fd = open(consts->path, O_RDWR | O_CREAT, 0644);
+    if (params->fd < 0)
+    {
+        return EXIT_FAILURE;
+    }
+
+    device->sys->initialized = 1;
+
+    return EXIT_SUCCESS;
+}
+
+/// @brief  Deinit function for a memfile
+static DEV_MEM_FUNC_DEINIT(memfileDeinit)
+{
+    tsMemfileParams *params = device->parameters;
+
+    if (params->fd >= 0)
+    {
+        close(params->fd);
+        params->fd = -1;
+    }
+    device->sys->initialized = 0;
+
+    return EXIT_SUCCESS;
+}
+
+/// @brief  Read function for a memfile, bytes not written yet read as erased
+static DEV_MEM_FUNC_READ(memfileRead)
+{
+    const tsMemfileParams *params = device->parameters;
+    ssize_t received;
+
+    if (memfileFit(device, address, length) < length)
+    {
+        return EXIT_FAILURE;
+    }
+
+    received = pread(params->fd, readData, length, address);
+    if (received < 0)
+    {
+        return EXIT_FAILURE;
+    }
+    memset((uint8_t *)readData + received, 0xFF, length - (size_t)received); // Not written yet
+
+    return EXIT_SUCCESS;
+}
+
+/// @brief  Write function for a memfile, also used to program
+static DEV_MEM_FUNC_WRITE(memfileWrite)
+{
+    const tsMemfileParams *params = device->parameters;
+
+    if (memfileFit(device, address, length) < length)
+    {
+        return EXIT_FAILURE;
+    }
+
+    return (pwrite(params->fd, writeData, length, address) == (ssize_t)length) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/// @brief  Erase function for a memfile, sets the area to 0xFF
+/// @return Size of erased area
+static DEV_MEM_FUNC_ERASE(memfileErase)
+{
+    uint8_t erased[MEMFILE_ERASE_CHUNK];
+    uint32_t done = 0;
+    uint16_t length;
+
+    memset(erased, 0xFF, sizeof(erased));
+
+    while (done < size)
+    {
+        length = memfileFit(device, address + done, (uint16_t)MIN(size - done, sizeof(erased)));
+        if ((0 == length) || (EXIT_SUCCESS != memfileWrite(device, address + done, erased, length)))
+        {
+            break;
+        }
+        done += length;
+    }
+
+    return done;
+}
+
+/** @} */
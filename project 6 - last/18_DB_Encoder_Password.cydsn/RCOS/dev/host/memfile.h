@@ -0,0 +1,63 @@
+/** @file       host/memfile.h
+ *  @brief      Memory device kept in a file of POSIX hosts
+ *  @copyright  (c) 2026-Arcelik - All Rights Reserved
+ *              Permission to use, reproduce, copy, prepare derivative works,
+ *              modify, distribute, perform, display or sell this software and/or
+ *              its documentation for any purpose is prohibited without the express
+ *              written consent of Arcelik A.S.
+ *  @date       17.10.2026
+ */
+#ifndef FILE_MEMFILE_H
+#define FILE_MEMFILE_H
+
+#include "rcos.h"
+
+/**
+ *  @defgroup   HOST_MEMFILE MEMFILE
+ *  @ingroup    HOST_DEV_MEM
+ *  @brief      Memory device whose contents are kept in a file, file is created on init if it does not exist.
+ *              Erased bytes read as 0xFF like flash memories, reads beyond the end of file return erased bytes.
+ *  @{
+ */
+
+#ifndef FILE_MEMFILE_C
+#define INTERFACE extern
+#else
+#define INTERFACE
+#endif
+
+/// @brief  Functions for MEMFILE devices
+INTERFACE const tsDevMemFuncs devMemMemfileFuncs;
+
+/// @brief  Device specific constants
+typedef struct
+{
+    const char *path; ///< Path of file
+    uint32_t size;    ///< Size of memory
+} tsMemfileConsts;
+
+/// @brief  Device specific parameters
+typedef struct
+{
+    int fd; ///< File descriptor while initialized
+} tsMemfileParams;
+
+/** @brief  Create a devMem kept in a file
+ *  @param  _name   Name of devMem object
+ *  @param  _path   Path of file
+ *  @param  _size   Size of memory
+ */
+#define DEV_MEM_MEMFILE_CREATE(_name, _path, _size) \
+    tsMemfileParams _name##Params = {-1};           \
+    const tsMemfileConsts _name##Consts =           \
+        {                                           \
+            .path = (_path),                        \
+            .size = (_size),                        \
+    };                                              \
+    DEV_MEM_CREATE(_name, devMemMemfileFuncs, &_name##Params, &_name##Consts)
+
+#undef INTERFACE // Should not let this roam free
+
+/** @} */
+
+#endif // FILE_MEMFILE_H
@@ -0,0 +1,466 @@
+/** @file       host/platform.c
+ *  @brief      Platform specific modifications for POSIX hosts(Linux)
+ *  @copyright  (c) 2026-Arcelik - All Rights Reserved
+ *              Permission to use, reproduce, copy, prepare derivative works,
+ *              modify, distribute, perform, display or sell this software and/or
+ *              its documentation for any purpose is prohibited without the express
+ *              written consent of Arcelik A.S.
+ *  @date       17.10.2026
+ */
+#define FILE_PLATFORM_C
+
+/*********************************************************************
+ *  INCLUDES
+ */
+#include "rcos.h"
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/timerfd.h>
+
+#ifndef RCOS_PLATFORM_HOST
+#error this file is prepared for HOST only
+#endif
+
+/** @addtogroup HOST
+ *  @{
+ */
+
+/*********************************************************************
+ *  EXPORTED TYPEDEFS
+ */
+
+/*********************************************************************
+ *  EXPORTED MACROS
+ */
+
+/*********************************************************************
+ *  LOCAL VARIABLES
+ */
+static pthread_once_t intLockOnce = PTHREAD_ONCE_INIT;
+static pthread_mutex_t intLock;         ///< Held while interrupts are disabled or an isr is running
+static __thread uint32_t intNesting;    ///< globalIntDisable nesting of calling thread
+static __thread teBool isrActive;       ///< Calling thread is running an isr
+
+static pthread_t tickThread;
+static pthread_cond_t tickWake = PTHREAD_COND_INITIALIZER; ///< Signalled after an isr while coreRun sleeps
+static int tickFd = -1;                 ///< timerfd that wakes the tick thread
+static volatile uint8_t tickMasked;     ///< rcosTick.disable was called
+static uint64_t tickLast;               ///< Time of last tick given to core, ticks are counted from clock to catch up late ones
+static teBool tickIdle;                 ///< coreRun sleeps in hostTickProgram
+
+/// @brief  Thread of an executor group
+static struct
+{
+    pthread_t thread;
+    pthread_cond_t wake; ///< Signalled by hostExecutorWake
+    teBool woken;        ///< hostExecutorWake was called since last wait
+    void (*run)(uint8_t group);
+} executorThreads[HOST_EXECUTOR_GROUPS_MAX];
+
+static pthread_once_t hrTimerOnce = PTHREAD_ONCE_INIT;
+static pthread_t hrTimerThread;
+static pthread_cond_t hrTimerWake;      ///< Signalled when a deadline is programmed, runs on CLOCK_MONOTONIC
+static uint64_t hrTimerTarget;          ///< Time of programmed deadline
+static teBool hrTimerArmed;             ///< A deadline is programmed
+
+static volatile uint8_t wdtRunning;
+static volatile uint64_t wdtRefreshed;  ///< Time of last refresh
+
+/*********************************************************************
+ *  LOCAL FUNCTIONS
+ */
+static void intLockInit(void)
+{
+    pthread_mutexattr_t attr;
+
+    pthread_mutexattr_init(&attr);
+    pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+    pthread_mutex_init(&intLock, &attr);
+    pthread_mutexattr_destroy(&attr);
+}
+
+/// @brief  Monotonic time in nanoseconds
+static uint64_t hostNow(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+/// @brief  Convert monotonic time in nanoseconds to timespec
+static void hostTimespec(uint64_t time, struct timespec *ts)
+{
+    ts->tv_sec  = (time_t)(time / 1000000000ull);
+    ts->tv_nsec = (long)(time % 1000000000ull);
+}
+
+static void wdtCheck(uint64_t now)
+{
+    if (wdtRunning && ((now - wdtRefreshed) >= (HOST_WDT_TIMEOUT_MS * 1000000ull)))
+    {
+        fprintf(stderr, "\r\nrcos: watchdog reset\r\n");
+        _exit(2);
+    }
+}
+
+/// @brief  Set next tick thread wake up time, periodic ticks follow it if periodic is TRUE
+static void tickArm(uint64_t time, teBool periodic)
+{
+    struct itimerspec spec;
+
+    hostTimespec(time, &spec.it_value);
+    spec.it_interval.tv_sec  = 0;
+    spec.it_interval.tv_nsec = periodic ? HOST_TICK_PERIOD_NS : 0;
+    timerfd_settime(tickFd, TFD_TIMER_ABSTIME, &spec, NULL);
+}
+
+/// @brief  Give ticks passed since last call to core as a tick isr, intLock must be held
+static void tickService(void)
+{
+    uint64_t ticks  = (hostNow() - tickLast) / HOST_TICK_PERIOD_NS;
+    teBool isrSaved = isrActive;
+
+    if (tickMasked || (0 == ticks))
+    {
+        return; // Masked ticks are delivered late, they stay in the clock
+    }
+
+    tickLast += ticks * HOST_TICK_PERIOD_NS;
+    isrActive = TRUE;
+    rcosTickIsrElapsed((uint32_t)ticks);
+    isrActive = isrSaved;
+}
+
+/// @brief  Wake coreRun up if it sleeps in hostTickProgram, intLock must be held
+static void tickWakeUp(void)
+{
+    if (tickIdle)
+    {
+        tickIdle = FALSE;
+        pthread_cond_broadcast(&tickWake);
+    }
+}
+
+static void *tickThreadFunc(void *arg)
+{
+    uint64_t expirations;
+
+    UNUSED(arg);
+
+    for (;;)
+    {
+        if (read(tickFd, &expirations, sizeof(expirations)) != sizeof(expirations))
+        {
+            continue;
+        }
+
+        wdtCheck(hostNow()); // Without intLock, a core spinning with interrupts disabled must still be reset
+
+        globalIntDisable();
+        tickService();
+        tickWakeUp();
+        globalIntEnable();
+    }
+
+    return NULL;
+}
+
+static void hrTimerInit(void)
+{
+    pthread_condattr_t attr;
+
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_cond_init(&hrTimerWake, &attr);
+    pthread_condattr_destroy(&attr);
+}
+
+static void *hrTimerThreadFunc(void *arg)
+{
+    struct timespec ts;
+    uint64_t target;
+
+    UNUSED(arg);
+
+    globalIntDisable();
+    for (;;)
+    {
+        if (FALSE == hrTimerArmed)
+        {
+            pthread_cond_wait(&hrTimerWake, &intLock);
+            continue;
+        }
+
+        target = hrTimerTarget;
+        if (hostNow() + HOST_HRTIMER_LEAD_NS < target)
+        {
+            // Waiting releases intLock, an earlier deadline programmed meanwhile signals the condition
+            hostTimespec(target - HOST_HRTIMER_LEAD_NS, &ts);
+            pthread_cond_timedwait(&hrTimerWake, &intLock, &ts);
+            continue;
+        }
+
+        if (hostNow() < target)
+        {
+            globalIntEnable();
+            hostTimespec(target, &ts);
+            clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL);
+            globalIntDisable();
+            continue; // Deadline may have been moved while sleeping
+        }
+
+        hrTimerArmed = FALSE;
+        hostIsrRun(rcosHrTimerIsr);
+    }
+
+    return NULL;
+}
+
+static void *executorThreadFunc(void *arg)
+{
+    uint8_t group = (uint8_t)(uintptr_t)arg;
+
+    executorThreads[group].run(group);
+
+    return NULL;
+}
+
+/*********************************************************************
+ *  INTERFACES: FUNCTIONS
+ */
+void platformInit(void)
+{
+    ADD_RCOS_VERSION("host/platform", "1.0.0")
+
+    pthread_once(&intLockOnce, intLockInit);
+    setvbuf(stdout, NULL, _IONBF, 0);
+
+    globalIntEnable();
+}
+
+void globalIntEnable(void)
+{
+    if (intNesting)
+    {
+        intNesting--;
+        pthread_mutex_unlock(&intLock);
+    }
+}
+
+void globalIntDisable(void)
+{
+    pthread_once(&intLockOnce, intLockInit);
+    pthread_mutex_lock(&intLock);
+    intNesting++;
+}
+
+teBool isIsrActive(void)
+{
+    return isrActive;
+}
+
+void getUniqId(uint8_t *ptr, uint8_t length)
+{
+    uint8_t tempBuff[8] = {0};
+    long id             = gethostid();
+
+    memcpy(tempBuff, &id, MIN(sizeof(id), sizeof(tempBuff)));
+    memcpy(ptr, tempBuff, MIN(length, sizeof(tempBuff)));
+}
+
+uint32_t ntohl(uint32_t data)
+{
+    return htonl(data);
+}
+
+uint32_t htonl(uint32_t _32)
+{
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    return _32;
+#else
+    return ((((_32)&0xfful) << 24) |
+            (((_32)&0xff00ul) << 8) |
+            (((_32)&0xff0000ul) >> 8) |
+            (((_32)&0xff000000ul) >> 24));
+#endif
+}
+
+uint16_t ntohs(uint16_t _16)
+{
+    return htons(_16);
+}
+
+uint16_t htons(uint16_t _16)
+{
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    return _16;
+#else
+    return ((((_16)&0xfful) << 8) | (((_16)&0xff00ul) >> 8));
+#endif
+}
+
+void hostIsrRun(void (*isr)(void))
+{
+    globalIntDisable();
+    isrActive = TRUE;
+    isr();
+    isrActive = FALSE;
+    tickWakeUp();
+    globalIntEnable();
+}
+
+void hostTickStart(void)
+{
+    tickFd = timerfd_create(CLOCK_MONOTONIC, 0);
+    if (tickFd < 0)
+    {
+        perror("rcos: timerfd_create");
+        return;
+    }
+
+    tickMasked = 0;
+    tickLast   = hostNow();
+    tickArm(tickLast + HOST_TICK_PERIOD_NS, TRUE);
+    pthread_create(&tickThread, NULL, tickThreadFunc, NULL);
+}
+
+CORE_TICK_PROGRAM_PROTO(hostTickProgram)
+{
+    if (tickFd < 0)
+    {
+        return;
+    }
+
+    // Called from coreRun with intLock held once, waiting releases it for isrs
+    tickArm(tickLast + (uint64_t)MIN(ticks, HOST_TICK_IDLE_MAX) * HOST_TICK_PERIOD_NS, FALSE);
+    tickIdle = TRUE;
+    while (tickIdle)
+    {
+        pthread_cond_wait(&tickWake, &intLock);
+    }
+
+    tickService(); // Woken by another isr before tick thread has run
+    tickArm(tickLast + HOST_TICK_PERIOD_NS, TRUE);
+}
+
+void hostTickEnable(void)
+{
+    tickMasked = 0;
+}
+
+void hostTickDisable(void)
+{
+    tickMasked = 1;
+}
+
+void hostExecutorSpawn(void (*run)(uint8_t group), uint8_t group)
+{
+    if (group >= HOST_EXECUTOR_GROUPS_MAX)
+    {
+        fprintf(stderr, "rcos: executor group %u is over HOST_EXECUTOR_GROUPS_MAX\n", group);
+        exit(EXIT_FAILURE);
+    }
+
+    executorThreads[group].run = run;
+    pthread_cond_init(&executorThreads[group].wake, NULL);
+    pthread_create(&executorThreads[group].thread, NULL, executorThreadFunc, (void *)(uintptr_t)group);
+}
+
+void hostExecutorWait(uint8_t group)
+{
+    // Called with intLock held once, waiting releases it for isrs and other groups
+    while (FALSE == executorThreads[group].woken)
+    {
+        pthread_cond_wait(&executorThreads[group].wake, &intLock);
+    }
+    executorThreads[group].woken = FALSE;
+}
+
+void hostExecutorWake(uint8_t group)
+{
+    if (0 == group)
+    {
+        tickWakeUp(); // coreRun sleeps in hostTickProgram
+        return;
+    }
+
+    executorThreads[group].woken = TRUE;
+    pthread_cond_signal(&executorThreads[group].wake);
+}
+
+void hostHrTimerStart(void)
+{
+    pthread_once(&hrTimerOnce, hrTimerInit);
+    pthread_create(&hrTimerThread, NULL, hrTimerThreadFunc, NULL);
+}
+
+uint32_t hostHrTimerNow(void)
+{
+    return (uint32_t)(hostNow() / 1000ull);
+}
+
+void hostHrTimerProgram(uint32_t deadline)
+{
+    uint64_t now = hostNow() / 1000ull;
+    int32_t delay = (int32_t)(deadline - (uint32_t)now);
+
+    pthread_once(&hrTimerOnce, hrTimerInit); // Timers may be started before coreRun
+    hrTimerTarget = (delay > 0) ? ((now + (uint32_t)delay) * 1000ull) : 0;
+    hrTimerArmed  = TRUE;
+    pthread_cond_signal(&hrTimerWake);
+}
+
+void hostHrTimerCancel(void)
+{
+    hrTimerArmed = FALSE;
+}
+
+void hostSimulationEnd(void)
+{
+    fprintf(stderr, "rcos: simulation ended at tick %u\n", rcosTickCount());
+    exit(EXIT_SUCCESS);
+}
+
+uint32_t hostCycles(void)
+{
+    return (uint32_t)hostNow();
+}
+
+uint32_t hostStackPaint(uint8_t **base)
+{
+    volatile uint8_t area[HOST_STACK_PAINT]; // Frame of this function is the area, it is left painted on return
+    volatile uintptr_t address = (uintptr_t)area; // Address is kept after return on purpose
+    uint32_t idx;
+
+    for (idx = 0; idx < sizeof(area); idx++)
+    {
+        area[idx] = CORE_WATERMARK_PAINT;
+    }
+    *base = (uint8_t *)address;
+
+    return sizeof(area);
+}
+
+void hostWdtRefresh(void)
+{
+    wdtRefreshed = hostNow();
+}
+
+void hostWdtStart(void)
+{
+    wdtRefreshed = hostNow();
+    wdtRunning   = 1;
+}
+
+void hostWdtStop(void)
+{
+    wdtRunning = 0;
+}
+
+/** @} */
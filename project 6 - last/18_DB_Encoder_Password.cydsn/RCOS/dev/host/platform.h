@@ -0,0 +1,238 @@
+/** @file       host/platform.h
+ *  @brief      Platform specific modifications for POSIX hosts(Linux)
+ *  @copyright  (c) 2026-Arcelik - All Rights Reserved
+ *              Permission to use, reproduce, copy, prepare derivative works,
+ *              modify, distribute, perform, display or sell this software and/or
+ *              its documentation for any purpose is prohibited without the express
+ *              written consent of Arcelik A.S.
+ *  @date       17.10.2026
+ */
+#ifndef FILE_PLATFORM_H
+#define FILE_PLATFORM_H
+
+/**
+ *  @defgroup   HOST HOST
+ *  @brief      POSIX host(Linux) platform to run RCoS+ applications as a normal executable
+ *  @details    Interrupts are emulated with threads:
+ *              - globalIntDisable/globalIntEnable lock/unlock a recursive mutex that every ISR also holds
+ *              - rcosTickIsr is called from a tick thread driven by a 1ms periodic timerfd
+ *              - With HOST_TICKLESS, coreRun sleeps on a condition until next timer expiry or any isr instead of spinning
+ *              - With HOST_SIMULATION, timers run in virtual time and there is no tick thread, see CORE_TICK_CREATE_SIMULATION
+ *              - Watchdog is emulated on the tick thread, an expired watchdog terminates the process
+ *              - With CORE_EXECUTOR_DEFAULT, executor groups other than 0 are dispatched by their own pthreads
+ *              - With CORE_HRTIMER_DEFAULT, rcosHrTimerIsr is called from a thread that sleeps until the programmed
+ *                deadline, counter is CLOCK_MONOTONIC in microseconds and it is not simulated by HOST_SIMULATION
+ *  @ingroup    PLATFORM
+ *  @{
+ *      @defgroup   HOST_DEV_IO DEV_IO
+ *      @defgroup   HOST_DEV_COM DEV_COM
+ *      @defgroup   HOST_DEV_MEM DEV_MEM
+ *      @defgroup   HOST_DEV_CPX DEV_CPX
+ */
+
+/*********************************************************************
+ *  INCLUDES
+ */
+#include <stdint.h>
+
+#ifndef FILE_PLATFORM_C
+#define INTERFACE extern
+#else
+#define INTERFACE
+#endif
+
+/*********************************************************************
+ *  EXPORTED TYPEDEFS
+ */
+
+/*********************************************************************
+ *  EXPORTED MACROS
+ */
+#ifndef HOST_TICK_PERIOD_NS
+#define HOST_TICK_PERIOD_NS (1000000ul) ///< Period of rcosTickIsr calls in nanoseconds
+#endif
+
+#ifndef HOST_WDT_TIMEOUT_MS
+#define HOST_WDT_TIMEOUT_MS (2000ul) ///< Watchdog timeout in milliseconds
+#endif
+
+#ifndef HOST_TICKLESS
+#define HOST_TICKLESS (1) ///< Default tick sleeps in coreRun when there is nothing to do, 0 to spin like target firmware
+#endif
+
+#ifndef HOST_STACK_PAINT
+#define HOST_STACK_PAINT (65536ul) ///< Bytes of stack painted below coreRun for high-water reports
+#endif
+
+#ifndef HOST_SIMULATION
+#define HOST_SIMULATION (0) ///< Length in ticks of a virtual time simulation run by default tick instead of real time, 0 for real time
+#endif
+
+/// @brief  Longest tickless sleep in ticks, half of watchdog timeout so that coreRun can refresh it in time
+#define HOST_TICK_IDLE_MAX ((HOST_WDT_TIMEOUT_MS / 2) * 1000000ul / HOST_TICK_PERIOD_NS)
+
+#if HOST_SIMULATION
+/// @brief  Create a default tick configuration for this platform, program exits when simulation ends
+/// @param  _idx    Not used, kept for compatibility with other platforms
+#define CORE_TICK_DEFAULT(_idx) \
+    CORE_TICK_CREATE_SIMULATION(HOST_SIMULATION, hostSimulationEnd)
+#elif HOST_TICKLESS
+/// @brief  Create a default tick configuration for this platform
+/// @param  _idx    Not used, kept for compatibility with other platforms
+#define CORE_TICK_DEFAULT(_idx) \
+    CORE_TICK_CREATE_TICKLESS(hostTickStart, hostTickEnable, hostTickDisable, hostTickProgram)
+#else
+/// @brief  Create a default tick configuration for this platform
+/// @param  _idx    Not used, kept for compatibility with other platforms
+#define CORE_TICK_DEFAULT(_idx) \
+    CORE_TICK_CREATE(hostTickStart, hostTickEnable, hostTickDisable)
+#endif
+
+/// @brief  Create a default watchdog timer
+/// @param  _flagCount  Number of flags
+#define CORE_WDT_DEFAULT(_flagCount) \
+    CORE_WDT_CREATE(hostWdtRefresh, hostWdtStart, hostWdtStop, (_flagCount))
+
+/// @brief  Create a profiler with clock_gettime as cycle source, one cycle is one nanosecond
+/// @param  _entries    Number of process and event pairs that can be recorded
+#define CORE_PROFILER_DEFAULT(_entries) \
+    CORE_PROFILER_CREATE((_entries), hostCycles, 1000000000ul)
+
+/// @brief  Create a trace ring with clock_gettime as cycle source, one cycle is one nanosecond
+/// @param  _records    Number of records in ring
+#define CORE_TRACE_DEFAULT(_records) \
+    CORE_TRACE_CREATE((_records), hostCycles, 1000000000ul)
+
+/// @brief  Create boot with clock_gettime as cycle source, one cycle is one nanosecond
+/// @param  _devices    Array of tsBootDevice entries
+/// @param  _processes  Array of tsBootProcess entries
+#define CORE_BOOT_DEFAULT(_devices, _processes) \
+    CORE_BOOT_CREATE(_devices, _processes, hostCycles, 1000000000ul)
+
+/// @brief  Create high-water reports with HOST_STACK_PAINT bytes of stack painted
+/// @param  _areas  Array of tsWatermarkArea entries
+#define CORE_WATERMARK_DEFAULT(_areas) \
+    CORE_WATERMARK_CREATE(_areas, hostStackPaint)
+
+#ifndef HOST_EXECUTOR_GROUPS_MAX
+#define HOST_EXECUTOR_GROUPS_MAX (16) ///< Largest number of executor groups
+#endif
+
+/** @brief  Create an executor that dispatches each group other than 0 on its own pthread, see CORE_EXECUTOR_CREATE
+ *  @param  _groups     Number of groups including group 0 of coreRun, up to HOST_EXECUTOR_GROUPS_MAX
+ *  @param  _queueSize  Size of the queue of each group in bytes
+ *  @param  _ringSize   Number of posts that can wait in the ring of each group, must be a power of 2
+ */
+#define CORE_EXECUTOR_DEFAULT(_groups, _queueSize, _ringSize) \
+    CORE_EXECUTOR_CREATE((_groups), (_queueSize), (_ringSize), hostExecutorSpawn, hostExecutorWait, hostExecutorWake)
+
+#ifndef HOST_HRTIMER_LEAD_NS
+#define HOST_HRTIMER_LEAD_NS (200000ul) ///< Last part of a high resolution timer wait that is slept with clock_nanosleep
+#endif
+
+/** @brief  Create a high resolution timer source on CLOCK_MONOTONIC, see CORE_HRTIMER_CREATE
+ *  @param  _counter    Not used, kept for compatibility with other platforms
+ *  @param  _isr        Not used, kept for compatibility with other platforms
+ */
+#define CORE_HRTIMER_DEFAULT(_counter, _isr) \
+    CORE_HRTIMER_CREATE(hostHrTimerStart, hostHrTimerNow, hostHrTimerProgram, hostHrTimerCancel)
+
+/*********************************************************************
+ *  INTERFACES
+ */
+#define PLATFORM_ASM(_asm) __asm__(_asm)
+#define PLATFORM_SECTION(_name) __attribute__((section(_name)))
+#define PLATFORM_ALIGNED(_align) __attribute__((aligned(_align)))
+#define PLATFORM_STATIC_INLINE static inline
+#define PLATFORM_WEAK __attribute__((weak))
+#define PLATFORM_PACKED __attribute__((packed))
+#define PLATFORM_THREAD_LOCAL __thread
+
+/*********************************************************************
+ *  INTERFACES: CONSTANTS
+ */
+
+/*********************************************************************
+ *  INTERFACES: VARIABLES
+ */
+
+/*********************************************************************
+ *  INTERFACES: FUNCTIONS
+ */
+
+/// @brief  Start the tick thread that calls rcosTickIsr every HOST_TICK_PERIOD_NS
+INTERFACE void hostTickStart(void);
+
+/// @brief  Unmask tick interrupt, ticks that arrived while masked are delivered late
+INTERFACE void hostTickEnable(void);
+
+/// @brief  Mask tick interrupt
+INTERFACE void hostTickDisable(void);
+
+/** @brief  Tickless idle, sleep until ticks have passed or an isr has run
+ *  @param  ticks   Ticks until next timer expiry, limited to HOST_TICK_IDLE_MAX
+ */
+INTERFACE void hostTickProgram(uint32_t ticks);
+
+/// @brief  End of a HOST_SIMULATION run, exits the program so that atexit functions can report results
+INTERFACE void hostSimulationEnd(void);
+
+/** @brief  Start a pthread for an executor group
+ *  @param  run     Dispatch loop of group, never returns
+ *  @param  group   Executor group
+ */
+INTERFACE void hostExecutorSpawn(void (*run)(uint8_t group), uint8_t group);
+
+/// @brief  Sleep thread of an executor group until hostExecutorWake, called with intLock held
+INTERFACE void hostExecutorWait(uint8_t group);
+
+/// @brief  Wake thread of an executor group, group 0 is woken from hostTickProgram
+INTERFACE void hostExecutorWake(uint8_t group);
+
+/// @brief  Start the thread that calls rcosHrTimerIsr
+INTERFACE void hostHrTimerStart(void);
+
+/// @brief  Monotonic clock in microseconds, wraps around every 71 minutes
+INTERFACE uint32_t hostHrTimerNow(void);
+
+/** @brief  Wake high resolution timer thread at a deadline, called with intLock held
+ *  @details Thread waits on a condition until HOST_HRTIMER_LEAD_NS before deadline and sleeps the rest with clock_nanosleep,
+ *           an earlier deadline programmed in that last part is late by up to HOST_HRTIMER_LEAD_NS.
+ *  @param  deadline    hostHrTimerNow value to call rcosHrTimerIsr at
+ */
+INTERFACE void hostHrTimerProgram(uint32_t deadline);
+
+/// @brief  Disarm high resolution timer thread, called with intLock held
+INTERFACE void hostHrTimerCancel(void);
+
+/// @brief  Monotonic clock in nanoseconds, wraps around every 4.3 seconds
+INTERFACE uint32_t hostCycles(void);
+
+/** @brief  Paint HOST_STACK_PAINT bytes of stack below the caller with CORE_WATERMARK_PAINT
+ *  @details Stacks of executor threads are not painted.
+ *  @param  base    Lowest painted address
+ *  @return Number of bytes painted
+ */
+INTERFACE uint32_t hostStackPaint(uint8_t **base);
+
+/// @brief  Refresh emulated watchdog
+INTERFACE void hostWdtRefresh(void);
+
+/// @brief  Start emulated watchdog
+INTERFACE void hostWdtStart(void);
+
+/// @brief  Stop emulated watchdog
+INTERFACE void hostWdtStop(void);
+
+/** @brief  Run a function as an interrupt service routine
+ *  @details Used by host drivers and tick thread to call into RCoS+ as if an interrupt has occured.
+ *           Waits while interrupts are disabled and keeps isIsrActive TRUE during isr
+ *  @param  isr Interrupt service routine
+ */
+INTERFACE void hostIsrRun(void (*isr)(void));
+
+#undef INTERFACE // Should not let this roam free
+
+/** @} */
+
+#endif // FILE_PLATFORM_H
@@ -0,0 +1,133 @@
+/** @file       host/pwm.c
+ *  @brief      Pulse Width Modulation emulated on POSIX hosts
+ *  @copyright  (c) 2026-Arcelik - All Rights Reserved
+ *              Permission to use, reproduce, copy, prepare derivative works,
+ *              modify, distribute, perform, display or sell this software and/or
+ *              its documentation for any purpose is prohibited without the express
+ *              written consent of Arcelik A.S.
+ *  @date       17.10.2026
+ */
+#define FILE_PWM_C
+
+#include "pwm.h"
+
+/** @addtogroup HOST_PWM
+ *  @{
+ */
+
+static DEV_CPX_FUNC_INIT(pwmCoreInit);
+static DEV_CPX_FUNC_DEINIT(pwmCoreDeinit);
+
+static DEV_IO_FUNC_INIT(pwmSubInit);
+static DEV_IO_FUNC_DEINIT(pwmSubDeinit);
+static DEV_IO_FUNC_GET(pwmDutyGet);
+static DEV_IO_FUNC_PUT(pwmDutyPut);
+static DEV_IO_FUNC_GET(pwmFreqGet);
+static DEV_IO_FUNC_PUT(pwmFreqPut);
+
+/// @brief  Structure that defines the functions for pwm core
+const tsDevCpxFuncs devCpxPwmCoreFuncs =
+{
+    pwmCoreInit,
+    pwmCoreDeinit,
+};
+
+/// @brief  Structure that defines the functions for pwm duty
+const tsDevIoFuncs devIoPwmDutyFuncs =
+{
+    pwmSubInit,
+    pwmSubDeinit,
+    pwmDutyGet,
+    pwmDutyPut,
+};
+
+/// @brief  Structure that defines the functions for pwm frequency
+const tsDevIoFuncs devIoPwmFreqFuncs =
+{
+    pwmSubInit,
+    pwmSubDeinit,
+    pwmFreqGet,
+    pwmFreqPut,
+};
+
+/// @brief  Init function for a pwm core
+static DEV_CPX_FUNC_INIT(pwmCoreInit)
+{
+    UNUSED(config);
+
+    ADD_RCOS_VERSION("host/pwm", "1.0.0")
+
+    device->sys->initialized = 1;
+
+    return EXIT_SUCCESS;
+}
+
+/// @brief  Deinit function for a pwm core
+static DEV_CPX_FUNC_DEINIT(pwmCoreDeinit)
+{
+    device->sys->initialized = 0;
+
+    return EXIT_SUCCESS;
+}
+
+/// @brief  Init function for pwm sub devices, initializes core if necessary
+static DEV_IO_FUNC_INIT(pwmSubInit)
+{
+    const tsPwmSubConsts *consts = device->constants;
+
+    UNUSED(config);
+
+    if (!consts->mainDevice->sys->initialized)
+    {
+        devCpxInit(consts->mainDevice, NULL);
+    }
+    device->sys->initialized = 1;
+
+    return EXIT_SUCCESS;
+}
+
+/// @brief  Deinit function for pwm sub devices
+static DEV_IO_FUNC_DEINIT(pwmSubDeinit)
+{
+    device->sys->initialized = 0;
+
+    return EXIT_SUCCESS;
+}
+
+/// @brief  Get function for pwm duty
+static DEV_IO_FUNC_GET(pwmDutyGet)
+{
+    const tsPwmCoreParams *params = device->parameters;
+
+    return params->duty;
+}
+
+/// @brief  Put function for pwm duty
+static DEV_IO_FUNC_PUT(pwmDutyPut)
+{
+    tsPwmCoreParams *params = device->parameters;
+
+    params->duty = data;
+
+    return EXIT_SUCCESS;
+}
+
+/// @brief  Get function for pwm frequency
+static DEV_IO_FUNC_GET(pwmFreqGet)
+{
+    const tsPwmCoreParams *params = device->parameters;
+
+    return params->freq;
+}
+
+/// @brief  Put function for pwm frequency, 0 stops the output
+static DEV_IO_FUNC_PUT(pwmFreqPut)
+{
+    tsPwmCoreParams *params = device->parameters;
+
+    params->freq = data;
+
+    return EXIT_SUCCESS;
+}
+
+/** @} */
@@ -0,0 +1,103 @@
+/** @file       host/pwm.h
+ *  @brief      Pulse Width Modulation emulated on POSIX hosts
+ *  @copyright  (c) 2026-Arcelik - All Rights Reserved
+ *              Permission to use, reproduce, copy, prepare derivative works,
+ *              modify, distribute, perform, display or sell this software and/or
+ *              its documentation for any purpose is prohibited without the express
+ *              written consent of Arcelik A.S.
+ *  @date       17.10.2026
+ */
+#ifndef FILE_PWM_H
+#define FILE_PWM_H
+
+#include "rcos.h"
+
+/**
+ *  @defgroup   HOST_PWM PWM
+ *  @ingroup    HOST_DEV_CPX
+ *  @brief      Emulated PWM, frequency and duty cycle are only recorded
+ *  @{
+ */
+
+#ifndef FILE_PWM_C
+#define INTERFACE extern
+#else
+#define INTERFACE
+#endif
+
+INTERFACE const tsDevCpxFuncs devCpxPwmCoreFuncs; ///< Functions for PWM core devices
+
+/// @brief  Device specific constants
+typedef struct
+{
+    const char *name; ///< Name of the module on target board
+} tsPwmCoreConsts;
+
+/// @brief  Device specific parameters
+typedef struct
+{
+    uint32_t clock; ///< Input clock of module
+    uint32_t freq;  ///< Configured frequency
+    uint32_t duty;  ///< Configured duty cycle
+} tsPwmCoreParams;
+
+/// @brief  Sub device constants
+typedef struct
+{
+    const tsDevCpx *mainDevice;
+    tsPwmCoreParams *mainParams;
+} tsPwmSubConsts;
+
+/** @brief  Create a PWM core devCpx
+ *  @param  _name       Name of devCpx object
+ *  @param  _cyName     Name of the module on target board
+ *  @param  _clockHz    Input clock of module
+ *  @param  _freqHz     Initial frequency
+ *  @param  _duty       Initial duty cycle
+ */
+#define DEV_CPX_PWM_CORE_CREATE(_name, _cyName, _clockHz, _freqHz, _duty) \
+    const tsPwmCoreConsts _name##Consts =                                 \
+        {                                                                 \
+            #_cyName,                                                     \
+    };                                                                    \
+    tsPwmCoreParams _name##Params =                                       \
+        {                                                                 \
+            _clockHz,                                                     \
+            _freqHz,                                                      \
+            _duty,                                                        \
+    };                                                                    \
+    DEV_CPX_CREATE(_name, devCpxPwmCoreFuncs, &_name##Params, &_name##Consts)
+
+INTERFACE const tsDevIoFuncs devIoPwmDutyFuncs; ///< Functions for PWM Duty devices
+
+/** @brief  Create a PWM_DUTY devIO
+ *  @param  _name   Name of devIo object
+ *  @param  _devCpx PWM core device
+ */
+#define DEV_IO_PWM_DUTY_CREATE(_name, _devCpx) \
+    const tsPwmSubConsts _name##Consts =       \
+        {                                      \
+            &_devCpx,                          \
+            &_devCpx##Params,                  \
+    };                                         \
+    DEV_IO_CREATE(_name, devIoPwmDutyFuncs, &_devCpx##Params, &_name##Consts)
+
+INTERFACE const tsDevIoFuncs devIoPwmFreqFuncs; ///< Functions for PWM Frequency devices
+
+/** @brief  Create a PWM_FREQ devIO
+ *  @param  _name   Name of devIo object
+ *  @param  _devCpx PWM core device
+ */
+#define DEV_IO_PWM_FREQ_CREATE(_name, _devCpx) \
+    const tsPwmSubConsts _name##Consts =       \
+        {                                      \
+            &_devCpx,                          \
+            &_devCpx##Params,                  \
+    };                                         \
+    DEV_IO_CREATE(_name, devIoPwmFreqFuncs, &_devCpx##Params, &_name##Consts)
+
+#undef INTERFACE // Should not let this roam free
+
+/** @} */
+
+#endif // FILE_PWM_H
@@ -0,0 +1,112 @@
+/** @file       host/uart.c
+ *  @brief      Universal Asynchronous Receiver-Transmitter emulated on standard input/output of POSIX hosts
+ *  @copyright  (c) 2026-Arcelik - All Rights Reserved
+ *              Permission to use, reproduce, copy, prepare derivative works,
+ *              modify, distribute, perform, display or sell this software and/or
+ *              its documentation for any purpose is prohibited without the express
+ *              written consent of Arcelik A.S.
+ *  @date       17.10.2026
+ */
+#define FILE_UART_C
+
+#include "uart.h"
+#include <poll.h>
+#include <unistd.h>
+
+/** @addtogroup HOST_UART
+ *  @{
+ */
+
+static DEV_COM_FUNC_INIT(uartInit);
+static DEV_COM_FUNC_DEINIT(uartDeinit);
+static DEV_COM_FUNC_OPEN(uartOpen);
+static DEV_COM_FUNC_CLOSE(uartClose);
+static DEV_COM_FUNC_SEND(uartSend);
+static DEV_COM_FUNC_RECEIVE(uartReceive);
+
+/// @brief  Structure that defines the functions for uart
+const tsDevComFuncs devComUartFuncs =
+{
+    uartInit,
+    uartDeinit,
+    uartOpen,
+    uartClose,
+    uartSend,
+    uartReceive,
+    NULL,
+    NULL,
+};
+
+/// @brief  Init function for a uart
+static DEV_COM_FUNC_INIT(uartInit)
+{
+    ADD_RCOS_VERSION("host/uart", "1.0.0")
+
+    device->sys->initialized = 1;
+
+    return EXIT_SUCCESS;
+}
+
+/// @brief  Deinit function for a uart
+static DEV_COM_FUNC_DEINIT(uartDeinit)
+{
+    device->sys->initialized = 0;
+
+    return EXIT_SUCCESS;
+}
+
+/// @brief  Open function for a uart
+static DEV_COM_FUNC_OPEN(uartOpen)
+{
+    device->sys->opened = target;
+
+    return EXIT_SUCCESS;
+}
+
+/// @brief  Close function for a uart
+static DEV_COM_FUNC_CLOSE(uartClose)
+{
+    UNUSED(target);
+
+    device->sys->opened = NULL;
+    TICKET_REMOVE(device->sys->tvm);
+
+    return EXIT_SUCCESS;
+}
+
+/// @brief  Send function for a uart
+/// @return Number of bytes written
+static DEV_COM_FUNC_SEND(uartSend)
+{
+    const tsUartConsts *consts = device->constants;
+    ssize_t written;
+
+    if (!device->sys->initialized)
+    {
+        return 0;
+    }
+
+    written = write(consts->txFd, txb, length);
+
+    return (written > 0) ? (uint16_t)written : 0;
+}
+
+/// @brief  Receive function for a uart, does not block
+/// @return Number of bytes read
+static DEV_COM_FUNC_RECEIVE(uartReceive)
+{
+    const tsUartConsts *consts = device->constants;
+    struct pollfd pfd          = {consts->rxFd, POLLIN, 0};
+    ssize_t received;
+
+    if (!device->sys->initialized || (poll(&pfd, 1, 0) <= 0) || !(pfd.revents & POLLIN))
+    {
+        return 0;
+    }
+
+    received = read(consts->rxFd, rxb, length);
+
+    return (received > 0) ? (uint16_t)received : 0;
+}
+
+/** @} */
@@ -0,0 +1,56 @@
+/** @file       host/uart.h
+ *  @brief      Universal Asynchronous Receiver-Transmitter emulated on standard input/output of POSIX hosts
+ *  @copyright  (c) 2026-Arcelik - All Rights Reserved
+ *              Permission to use, reproduce, copy, prepare derivative works,
+ *              modify, distribute, perform, display or sell this software and/or
+ *              its documentation for any purpose is prohibited without the express
+ *              written consent of Arcelik A.S.
+ *  @date       17.10.2026
+ */
+#ifndef FILE_UART_H
+#define FILE_UART_H
+
+#include "rcos.h"
+
+/**
+ *  @defgroup   HOST_UART UART
+ *  @ingroup    HOST_DEV_COM
+ *  @brief      Emulated UART, transmitted data goes to stdout and received data comes from stdin
+ *  @{
+ */
+
+#ifndef FILE_UART_C
+#define INTERFACE extern
+#else
+#define INTERFACE
+#endif
+
+/// @brief  Functions for UART devices
+INTERFACE const tsDevComFuncs devComUartFuncs;
+
+/// @brief  Device specific constants
+typedef struct
+{
+    const char *name; ///< Name of the module on target board
+    int txFd;         ///< File descriptor used for transmit
+    int rxFd;         ///< File descriptor used for receive
+} tsUartConsts;
+
+/** @brief      Create a devCom
+ *  @param      _name   Name of devCom object
+ *  @param      _cyScb  Name of the module on target board
+ */
+#define DEV_COM_UART_CREATE(_name, _cyScb) \
+    const tsUartConsts _name##Consts =     \
+        {                                  \
+            #_cyScb,                       \
+            1,                             \
+            0,                             \
+    };                                     \
+    DEV_COM_CREATE(_name, devComUartFuncs, NULL, &_name##Consts)
+
+#undef INTERFACE // Should not let this roam free
+
+/** @} */
+
+#endif // FILE_UART_H
@@ -0,0 +1,106 @@
+/** @file       iocomb.c
+ *  @brief      C file of IOCOMB device
+ *  @copyright  (c) 2019-Arcelik - All Rights Reserved
+ *              Permission to use, reproduce, copy, prepare derivative works,
+ *              modify, distribute, perform, display or sell this software and/or
+ *              its documentation for any purpose is prohibited without the express
+ *              written consent of Arcelik A.S.
+ *  @date       17.10.2026
+ */
+#define FILE_IOCOMB_C
+
+#include "iocomb.h"
+
+/**
+ *  @addtogroup IOCOMB
+ *  @{
+ */
+
+static DEV_IO_FUNC_INIT(iocombInit);
+static DEV_IO_FUNC_DEINIT(iocombDeinit);
+static DEV_IO_FUNC_GET(iocombGet);
+static DEV_IO_FUNC_PUT(iocombPut);
+
+/// @brief  Structure that defines the functions for iocomb
+const tsDevIoFuncs devIoIocombFuncs =
+{
+    iocombInit,
+    iocombDeinit,
+    iocombGet,
+    iocombPut,
+};
+
+/// @brief  Init function for an iocomb, initializes every item
+static DEV_IO_FUNC_INIT(iocombInit)
+{
+    const tsIocombConsts *consts = device->constants;
+    uint8_t idx;
+
+    UNUSED(config);
+
+    ADD_RCOS_VERSION("dev/iocomb", "1.0.0")
+
+    for (idx = 0; idx < consts->count; idx++)
+    {
+        devIoInit(consts->list[idx].device, NULL);
+    }
+
+    device->sys->initialized = 1;
+
+    return EXIT_SUCCESS;
+}
+
+/// @brief  Deinit function for an iocomb, deinitializes every item
+static DEV_IO_FUNC_DEINIT(iocombDeinit)
+{
+    const tsIocombConsts *consts = device->constants;
+    uint8_t idx;
+
+    device->sys->initialized = 0;
+
+    for (idx = 0; idx < consts->count; idx++)
+    {
+        devIoDeinit(consts->list[idx].device);
+    }
+
+    return EXIT_SUCCESS;
+}
+
+/// @brief  Get function for an iocomb, first item is placed on least significant bits
+static DEV_IO_FUNC_GET(iocombGet)
+{
+    const tsIocombConsts *consts = device->constants;
+    uint32_t value               = 0;
+    uint8_t idx;
+
+    for (idx = consts->count; idx; idx--)
+    {
+        const tsIoCombItem *item = &consts->list[idx - 1];
+
+        value = (value << item->bitCount) | (devIoGet(item->device) & item->mask);
+    }
+
+    return value;
+}
+
+/// @brief  Put function for an iocomb, only changed items are updated
+static DEV_IO_FUNC_PUT(iocombPut)
+{
+    const tsIocombConsts *consts = device->constants;
+    uint8_t idx;
+
+    for (idx = 0; idx < consts->count; idx++)
+    {
+        const tsIoCombItem *item = &consts->list[idx];
+
+        if ((devIoGet(item->device) ^ data) & item->mask)
+        {
+            devIoPut(item->device, data & item->mask);
+        }
+        data >>= item->bitCount;
+    }
+
+    return EXIT_SUCCESS;
+}
+
+/** @} */
@@ -0,0 +1,120 @@
+/** @file       pattern.c
+ *  @brief      C file of PATTERN device
+ *  @copyright  (c) 2019-Arcelik - All Rights Reserved
+ *              Permission to use, reproduce, copy, prepare derivative works,
+ *              modify, distribute, perform, display or sell this software and/or
+ *              its documentation for any purpose is prohibited without the express
+ *              written consent of Arcelik A.S.
+ *  @date       17.10.2026
+ */
+#define FILE_PATTERN_C
+
+#include "pattern.h"
+
+/**
+ *  @addtogroup PATTERN
+ *  @{
+ */
+
+static DEV_IO_FUNC_INIT(patternInit);
+static DEV_IO_FUNC_DEINIT(patternDeinit);
+static DEV_IO_FUNC_GET(patternGet);
+static DEV_IO_FUNC_PUT(patternPut);
+
+/// @brief  Structure that defines the functions for pattern
+const tsDevIoFuncs devIoPatternFuncs =
+{
+    patternInit,
+    patternDeinit,
+    patternGet,
+    patternPut,
+};
+
+/// @brief  Timer callback that moves to the next node of the pattern
+/// @param  parameter   Pointer to pattern device
+/// @return Time to spend in the new node, 0 stops the timer
+TIMER_CALLBACK_FUNC(patternPutHandler)
+{
+    const tsDevIo *device   = parameter;
+    tsPatternParams *params = device->parameters;
+
+    params->node++;
+    if ((uint32_t)-1ul == params->node->time)
+    {
+        params->node = params->list;
+    }
+    devIoPut(params->target, params->node->value);
+
+    return params->node->time;
+}
+
+/// @brief  Init function for a pattern
+static DEV_IO_FUNC_INIT(patternInit)
+{
+    tsPatternParams *params       = device->parameters;
+    const tsPatternConsts *consts = device->constants;
+
+    UNUSED(config);
+
+    ADD_RCOS_VERSION("dev/pattern", "1.0.0")
+
+    timerCallBackStop(&params->timer);
+    params->list = NULL;
+    params->node = NULL;
+    devIoInit(params->target, NULL);
+    devIoPut(params->target, consts->offValue);
+
+    device->sys->initialized = 1;
+
+    return EXIT_SUCCESS;
+}
+
+/// @brief  Deinit function for a pattern
+static DEV_IO_FUNC_DEINIT(patternDeinit)
+{
+    tsPatternParams *params = device->parameters;
+
+    device->sys->initialized = 0;
+    timerCallBackStop(&params->timer);
+    params->list = NULL;
+    params->node = NULL;
+
+    return EXIT_SUCCESS;
+}
+
+/// @brief  Get function for a pattern
+static DEV_IO_FUNC_GET(patternGet)
+{
+    UNUSED(device);
+
+    return 0;
+}
+
+/// @brief  Put function for a pattern
+/// @param  data    Address of a tsPatternNode array, 0 turns the target off
+static DEV_IO_FUNC_PUT(patternPut)
+{
+    tsPatternParams *params       = device->parameters;
+    const tsPatternConsts *consts = device->constants;
+
+    timerCallBackStop(&params->timer);
+
+    if (data)
+    {
+        params->list = (const tsPatternNode *)(uintptr_t)data;
+        params->node = params->list;
+        devIoPut(params->target, params->node->value);
+        if (params->node->time)
+        {
+            timerCallBackStart(&params->timer, params->node->time);
+        }
+    }
+    else
+    {
+        devIoPut(params->target, consts->offValue);
+    }
+
+    return EXIT_SUCCESS;
+}
+
+/** @} */
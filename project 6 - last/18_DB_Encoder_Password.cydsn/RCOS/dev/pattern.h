@@ -71,20 +71,20 @@ typedef struct
  *  @param  _target     Target devIo to be used as output of PATTERN
  *  @param  _offValue   Off value for target device
  */
-#define DEV_IO_PATTERN_CREATE(_name, _target, _offValue)              \
-    extern TIMER_CALLBACK_FUNC(patternPutHandler);                    \
-    const tsDevIo _name;                                              \
-    tsPatternParams _name##Params =                                   \
-        {                                                             \
-            .timer  = TIMER_CALLBACK_INIT(patternPutHandler, &_name), \
-            .list   = NULL,                                           \
-            .node   = NULL,                                           \
-            .target = &_target,                                       \
-    };                                                                \
-    const tsPatternConsts _name##Consts =                             \
-        {                                                             \
-            .offValue = _offValue,                                    \
-    };                                                                \
+#define DEV_IO_PATTERN_CREATE(_name, _target, _offValue)                       \
+    extern TIMER_CALLBACK_FUNC(patternPutHandler);                             \
+    const tsDevIo _name;                                                       \
+    tsPatternParams _name##Params =                                            \
+        {                                                                      \
+            .timer  = TIMER_CALLBACK_INIT_DEFERRED(patternPutHandler, &_name), \
+            .list   = NULL,                                                    \
+            .node   = NULL,                                                    \
+            .target = &_target,                                                \
+    };                                                                         \
+    const tsPatternConsts _name##Consts =                                      \
+        {                                                                      \
+            .offValue = _offValue,                                             \
+    };                                                                         \
     DEV_IO_CREATE(_name, devIoPatternFuncs, &_name##Params, &_name##Consts)
 
 #undef INTERFACE // Should not let this roam free
@@ -71,7 +71,7 @@ typedef struct
     };                                                         \
     tsCapsenseParams _name##Params =                           \
         {                                                      \
-            TIMER_CALLBACK_INIT(capsenseIsr, &_name),          \
+            TIMER_CALLBACK_INIT_DEFERRED(capsenseIsr, &_name), \
     };                                                         \
     DEV_IO_CREATE(_name, devIoCapsenseFuncs, &_name##Params, &_name##Consts)
 
@@ -75,7 +75,7 @@ typedef struct
     };                                                    \
     tsCsdParams _name##Params =                           \
         {                                                 \
-            TIMER_CALLBACK_INIT(csdIsr, &_name),          \
+            TIMER_CALLBACK_INIT_DEFERRED(csdIsr, &_name), \
             0,                                            \
     };                                                    \
     DEV_IO_CREATE(_name, devIoCsdFuncs, &_name##Params, &_name##Consts)
@@ -74,6 +74,37 @@ void getUniqId(uint8_t *ptr, uint8_t length)
     memcpy(ptr, tempBuff, length);
 }
 
+uint32_t platformCycles(void)
+{
+    uint32_t reload = CySysTickGetReload() + 1;
+    uint32_t ticks;
+    uint32_t value;
+
+    do
+    {
+        ticks = rcosTickCount();
+        value = CySysTickGetValue();
+    } while (ticks != rcosTickCount());
+
+    return ticks * reload + (reload - 1 - value);
+}
+
+uint32_t platformStackPaint(uint8_t **base)
+{
+    extern uint8_t __cy_stack_limit; // Bottom of stack section, placed by cm0gcc.ld
+    uint8_t *top = (uint8_t *)__get_MSP() - PLATFORM_STACK_MARGIN;
+    uint8_t *pos;
+
+    // No calls while painting, they would place frames into the painted area
+    for (pos = &__cy_stack_limit; pos < top; pos++)
+    {
+        *pos = CORE_WATERMARK_PAINT;
+    }
+    *base = &__cy_stack_limit;
+
+    return (uint32_t)(top - &__cy_stack_limit);
+}
+
 uint32_t ntohl(uint32_t data)
 {
     return htonl(data);
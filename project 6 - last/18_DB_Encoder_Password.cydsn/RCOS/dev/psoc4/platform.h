@@ -81,6 +81,88 @@
     CORE_WDT_CREATE(wdtRefresh, wdtStart, wdtStop, (_flagCount))
 #endif
 
+/// @brief  Frequency of platformCycles in Hz
+#define PLATFORM_CYCLES_HZ (CYDEV_BCLK__SYSCLK__HZ)
+
+/// @brief  Create a profiler with SysTick as cycle source
+/// @param  _entries    Number of process and event pairs that can be recorded
+#define CORE_PROFILER_DEFAULT(_entries) \
+    CORE_PROFILER_CREATE((_entries), platformCycles, PLATFORM_CYCLES_HZ)
+
+/// @brief  Create a trace ring with SysTick as cycle source
+/// @param  _records    Number of records in ring
+#define CORE_TRACE_DEFAULT(_records) \
+    CORE_TRACE_CREATE((_records), platformCycles, PLATFORM_CYCLES_HZ)
+
+/// @brief  Create boot with SysTick as cycle source
+/// @param  _devices    Array of tsBootDevice entries
+/// @param  _processes  Array of tsBootProcess entries
+#define CORE_BOOT_DEFAULT(_devices, _processes) \
+    CORE_BOOT_CREATE(_devices, _processes, platformCycles, PLATFORM_CYCLES_HZ)
+
+/// @brief  Bytes left unpainted below the stack pointer while stack is painted, frame of painter lives there
+#define PLATFORM_STACK_MARGIN (32u)
+
+/// @brief  Create high-water reports with stack painted from __cy_stack_limit of linker script
+/// @param  _areas  Array of tsWatermarkArea entries
+#define CORE_WATERMARK_DEFAULT(_areas) \
+    CORE_WATERMARK_CREATE(_areas, platformStackPaint)
+
+/** @brief      Create a high resolution timer source on a TCPWM counter, see CORE_HRTIMER_CREATE
+ *  @details    TCPWM counters are 16 bits, upper 16 bits of the microsecond counter are counted on terminal count. Compare
+ *              value matches once every 65.536ms, rcosHrTimerIsr ignores matches before the deadline and programs again.
+ *  @warning    Counter must count up from a 1MHz clock with period 0xFFFF, terminal count and compare interrupts must be
+ *              connected to _cyIsr. A terminal count pending while interrupts are disabled makes hrTimerNow 65.536ms short.
+ *  @param      _cyCounter  CYPRESS TCPWM Block Name
+ *  @param      _cyIsr      CYPRESS ISR Block Name
+ */
+#define CORE_HRTIMER_DEFAULT(_cyCounter, _cyIsr)                                                    \
+    static volatile uint32_t hrTimerEpoch;                                                          \
+    uint32_t hrTimerCount(void)                                                                     \
+    {                                                                                               \
+        uint32_t epoch;                                                                             \
+        uint32_t count;                                                                             \
+                                                                                                    \
+        do                                                                                          \
+        {                                                                                           \
+            epoch = hrTimerEpoch;                                                                   \
+            count = _cyCounter##_ReadCounter();                                                     \
+        } while (epoch != hrTimerEpoch);                                                            \
+                                                                                                    \
+        return epoch | (count & 0xFFFFu);                                                           \
+    }                                                                                               \
+    CY_ISR(hrTimerCompareIsr)                                                                       \
+    {                                                                                               \
+        uint32_t source = _cyCounter##_GetInterruptSource();                                        \
+                                                                                                    \
+        _cyCounter##_ClearInterrupt(source);                                                        \
+        if (source & _cyCounter##_INTR_MASK_TC)                                                     \
+        {                                                                                           \
+            hrTimerEpoch += 0x10000u;                                                               \
+        }                                                                                           \
+        rcosHrTimerIsr();                                                                           \
+    }                                                                                               \
+    void hrTimerStart(void)                                                                         \
+    {                                                                                               \
+        _cyCounter##_Start();                                                                       \
+        _cyCounter##_SetInterruptMode(_cyCounter##_INTR_MASK_TC);                                   \
+        _cyIsr##_StartEx(hrTimerCompareIsr);                                                        \
+    }                                                                                               \
+    void hrTimerProgram(uint32_t deadline)                                                          \
+    {                                                                                               \
+        _cyCounter##_WriteCompare(deadline & 0xFFFFu);                                              \
+        _cyCounter##_SetInterruptMode(_cyCounter##_INTR_MASK_TC | _cyCounter##_INTR_MASK_CC_MATCH); \
+        if ((int32_t)(deadline - hrTimerCount()) <= 0)                                              \
+        {                                                                                           \
+            _cyIsr##_SetPending(); /* Compare value has passed before it is written */              \
+        }                                                                                           \
+    }                                                                                               \
+    void hrTimerCancel(void)                                                                        \
+    {                                                                                               \
+        _cyCounter##_SetInterruptMode(_cyCounter##_INTR_MASK_TC);                                   \
+    }                                                                                               \
+    CORE_HRTIMER_CREATE(hrTimerStart, hrTimerCount, hrTimerProgram, hrTimerCancel)
+
 /*********************************************************************
  *  INTERFACES
  */
@@ -107,6 +189,21 @@
  *  INTERFACES: FUNCTIONS
  */
 
+/** @brief      Free running cycle counter for profiler and trace
+ *  @details    Cortex-M0 has no cycle counter, SysTick value is extended with rcosTickCount. Reading is repeated if a
+ *              tick interrupt occurs in between, a reload pending while interrupts are disabled may still count one tick
+ *              short.
+ *  @return     Number of PLATFORM_CYCLES_HZ cycles since coreRun, wraps around
+ */
+uint32_t platformCycles(void);
+
+/** @brief      Paint stack from its limit up to PLATFORM_STACK_MARGIN below stack pointer with CORE_WATERMARK_PAINT
+ *  @details    Interrupts use the same stack on Cortex-M0, their frames are included in high-water mark.
+ *  @param      base    Lowest painted address
+ *  @return     Number of bytes painted
+ */
+uint32_t platformStackPaint(uint8_t **base);
+
 /** @} */
 
 #endif // FILE_PLATFORM_H
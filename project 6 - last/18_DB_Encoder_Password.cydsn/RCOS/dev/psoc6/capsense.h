@@ -64,7 +64,7 @@ typedef struct
     const tsDevIo _name;                                      \
     tsCapsenseParams _name##Params =                           \
         {                                                      \
-            TIMER_CALLBACK_INIT(capsenseIsr, &_name),          \
+            TIMER_CALLBACK_INIT_DEFERRED(capsenseIsr, &_name), \
     };                                                         \
     const tsCapsenseConsts _name##Consts =                     \
         {                                                      \
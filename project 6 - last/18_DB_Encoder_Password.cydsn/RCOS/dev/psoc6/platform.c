@@ -66,6 +66,18 @@ teBool isIsrActive(void)
     return ((SCB->ICSR & SCB_ICSR_VECTACTIVE_Msk) != 0);
 }
 
+uint32_t platformCycles(void)
+{
+    if (0 == (DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk))
+    {
+        CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+        DWT->CYCCNT = 0;
+        DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    }
+
+    return DWT->CYCCNT;
+}
+
 void getUniqId(uint8_t *ptr, uint8_t length)
 {
     uint8_t tempBuff[8];
@@ -60,6 +60,19 @@
     }                                \
     CORE_WDT_CREATE(wdtRefresh, wdtStart, wdtStop, (_flagCount))
 
+/// @brief  Frequency of platformCycles in Hz
+#define PLATFORM_CYCLES_HZ (CYDEV_CLK_FASTCLK__HZ)
+
+/// @brief  Create a profiler with DWT cycle counter of CM4 as cycle source
+/// @param  _entries    Number of process and event pairs that can be recorded
+#define CORE_PROFILER_DEFAULT(_entries) \
+    CORE_PROFILER_CREATE((_entries), platformCycles, PLATFORM_CYCLES_HZ)
+
+/// @brief  Create a trace ring with DWT cycle counter of CM4 as cycle source
+/// @param  _records    Number of records in ring
+#define CORE_TRACE_DEFAULT(_records) \
+    CORE_TRACE_CREATE((_records), platformCycles, PLATFORM_CYCLES_HZ)
+
 /*********************************************************************
  *  INTERFACES: CONSTANTS
  */
@@ -78,6 +91,11 @@
  *  INTERFACES: FUNCTIONS
  */
 
+/** @brief  Free running cycle counter for profiler and trace, DWT cycle counter is enabled on first call
+ *  @return Number of PLATFORM_CYCLES_HZ cycles, wraps around
+ */
+uint32_t platformCycles(void);
+
 /** @} */
 
 #endif // FILE_PLATFORM_H
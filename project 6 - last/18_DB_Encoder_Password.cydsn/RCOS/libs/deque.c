@@ -0,0 +1,142 @@
+/**
+ *  @file       deque.c
+ *  @brief      Generic structures and functions to create double ended queues
+ *  @copyright  (c) 2018-Arcelik - All Rights Reserved
+ *  @date       17.10.2026
+ */
+#define FILE_DEQUE_C
+
+#include "deque.h"
+#include "libs.h"
+#include <string.h>
+
+/** @addtogroup DEQUE
+ *  @{
+ */
+
+void dequeAddBack(tsDeque *deq, uint16_t size)
+{
+    deq->back = (uint16_t)((deq->back + size) % deq->size);
+    deq->count += size;
+    if (deq->count > deq->size)
+    {
+        // Overwritten data is lost from the front
+        deq->count = deq->size;
+        deq->front = deq->back;
+    }
+    deq->peak = MAX(deq->peak, deq->count);
+}
+
+void dequeAddFront(tsDeque *deq, uint16_t size)
+{
+    deq->front = (uint16_t)((deq->front + deq->size - (size % deq->size)) % deq->size);
+    deq->count += size;
+    if (deq->count > deq->size)
+    {
+        // Overwritten data is lost from the back
+        deq->count = deq->size;
+        deq->back  = deq->front;
+    }
+    deq->peak = MAX(deq->peak, deq->count);
+}
+
+void dequeRemBack(tsDeque *deq, uint16_t size)
+{
+    size       = MIN(size, deq->count);
+    deq->back  = (uint16_t)((deq->back + deq->size - size) % deq->size);
+    deq->count -= size;
+}
+
+void dequeRemFront(tsDeque *deq, uint16_t size)
+{
+    size       = MIN(size, deq->count);
+    deq->front = (uint16_t)((deq->front + size) % deq->size);
+    deq->count -= size;
+}
+
+void dequeFlush(tsDeque *deq)
+{
+    deq->count = 0;
+    deq->front = 0;
+    deq->back  = 0;
+}
+
+void dequeClear(tsDeque *deq)
+{
+    memset(deq->buffer, 0, deq->size);
+    dequeFlush(deq);
+}
+
+uint16_t dequePopBack(tsDeque *deq, void *destination, uint16_t size)
+{
+    uint16_t start;
+
+    size  = MIN(size, deq->count);
+    start = (uint16_t)((deq->back + deq->size - size) % deq->size);
+    dequePeek(deq, (uint16_t)(deq->count - size), destination, size);
+    deq->back = start;
+    deq->count -= size;
+
+    return size;
+}
+
+uint16_t dequePopFront(tsDeque *deq, void *destination, uint16_t size)
+{
+    size = MIN(size, deq->count);
+    dequePeek(deq, 0, destination, size);
+    dequeRemFront(deq, size);
+
+    return size;
+}
+
+uint16_t dequePushBack(tsDeque *deq, const void *source, uint16_t size)
+{
+    const uint8_t *src = source;
+    uint16_t idx;
+
+    for (idx = 0; idx < size; idx++)
+    {
+        deq->buffer[deq->back] = src[idx];
+        dequeAddBack(deq, 1);
+    }
+
+    return size;
+}
+
+uint16_t dequePushFront(tsDeque *deq, const void *source, uint16_t size)
+{
+    const uint8_t *src = source;
+    uint16_t idx;
+
+    // Last byte goes in first so that popping from the front keeps the order
+    for (idx = size; idx; idx--)
+    {
+        dequeAddFront(deq, 1);
+        deq->buffer[deq->front] = src[idx - 1];
+    }
+
+    return size;
+}
+
+void dequePeek(tsDeque *deq, uint16_t index, void *destination, uint16_t size)
+{
+    uint8_t *dst = destination;
+    uint16_t pos = (uint16_t)((deq->front + index) % deq->size);
+    uint16_t part;
+
+    if ((uint32_t)index + size > deq->count)
+    {
+        size = (index < deq->count) ? (uint16_t)(deq->count - index) : 0;
+    }
+
+    part = MIN(size, (uint16_t)(deq->size - pos));
+    memcpy(dst, &deq->buffer[pos], part);
+    memcpy(dst + part, deq->buffer, size - part);
+}
+
+void addDequeVersion()
+{
+    ADD_RCOS_VERSION("libs/deque", "1.0.0")
+}
+
+/** @} */
@@ -65,6 +65,7 @@ typedef struct
     uint16_t count;  ///< Amount of data in buffer
     uint16_t front;  ///< Front of the queue
     uint16_t back;   ///< Back of the queue
+    uint16_t peak;   ///< Largest amount of data held, kept on flush
 } tsDeque;
 
 /*********************************************************************
@@ -78,7 +79,8 @@ typedef struct
         .size   = sizeof(_array), \
         .count  = 0,              \
         .front  = 0,              \
-        .back   = 0               \
+        .back   = 0,              \
+        .peak   = 0               \
     }
 
 /** @brief  Create a deque object with name and a buffer area with size
@@ -97,6 +99,8 @@ typedef struct
 #define DEQUE_IS_EMPTY(_deqPtr) (!((_deqPtr)->count))
 /// @brief  Expression to check if DEQUE is full
 #define DEQUE_IS_FULL(_deqPtr) ((_deqPtr)->size == (_deqPtr)->count)
+/// @brief  Return largest amount of data held in DEQUE
+#define DEQUE_PEAK(_deqPtr) ((_deqPtr)->peak)
 
 /** @addtogroup FIFO
  *  @{
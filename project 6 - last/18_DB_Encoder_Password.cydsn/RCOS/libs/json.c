@@ -0,0 +1,150 @@
+/**
+ *  @file       json.c
+ *  @brief      Functions to print-out data in json format
+ *  @copyright  (c) 2018-Arcelik - All Rights Reserved
+ *  @date       17.10.2026
+ */
+#define FILE_JSON_C
+
+#include "json.h"
+#include "libs.h"
+#include <stdarg.h>
+#include <stdio.h>
+
+/** @addtogroup JSON
+ *  @{
+ */
+
+/// @brief  Size of buffer used to format JSON TEXT items
+#define JSON_TEXT_SIZE (256)
+
+static int (*jsonPrint)(const char *format, ...);
+static uint8_t firstItem = 1; ///< Next item is the first one of an object or array, no separator needed
+
+/// @brief  Separator placed before an item
+#define JSON_SEPARATOR() (firstItem ? "" : ",")
+
+void jsonInit(int (*printf)(const char *format, ...))
+{
+    ADD_RCOS_VERSION("json", "2.0.0")
+
+    jsonPrint = printf;
+    firstItem = 1;
+}
+
+void jsonObjOpen(const char *key)
+{
+    if (key)
+    {
+        jsonPrint("%s\"%s\":{", JSON_SEPARATOR(), key);
+    }
+    else
+    {
+        jsonPrint("%s{", JSON_SEPARATOR());
+    }
+    firstItem = 1;
+}
+
+void jsonObjClose(void)
+{
+    jsonPrint("}");
+    firstItem = 0;
+}
+
+void jsonArrOpen(const char *key)
+{
+    if (key)
+    {
+        jsonPrint("%s\"%s\":[", JSON_SEPARATOR(), key);
+    }
+    else
+    {
+        jsonPrint("%s[", JSON_SEPARATOR());
+    }
+    firstItem = 1;
+}
+
+void jsonArrClose(void)
+{
+    jsonPrint("]");
+    firstItem = 0;
+}
+
+void jsonString(const char *key, const char *string)
+{
+    if (key)
+    {
+        jsonPrint("%s\"%s\":\"%s\"", JSON_SEPARATOR(), key, string);
+    }
+    else
+    {
+        jsonPrint("%s\"%s\"", JSON_SEPARATOR(), string);
+    }
+    firstItem = 0;
+}
+
+void jsonText(const char *key, const char *format, ...)
+{
+    char text[JSON_TEXT_SIZE];
+    va_list args;
+
+    va_start(args, format);
+    vsnprintf(text, sizeof(text), format, args);
+    va_end(args);
+
+    jsonString(key, text);
+}
+
+void jsonNumber(const char *key, uint32_t number)
+{
+    if (key)
+    {
+        jsonPrint("%s\"%s\":%d", JSON_SEPARATOR(), key, number);
+    }
+    else
+    {
+        jsonPrint("%s%d", JSON_SEPARATOR(), number);
+    }
+    firstItem = 0;
+}
+
+void jsonFloat(const char *key, float number, uint8_t precision)
+{
+    if (key)
+    {
+        jsonPrint("%s\"%s\":%.*f", JSON_SEPARATOR(), key, precision, (double)number);
+    }
+    else
+    {
+        jsonPrint("%s%.*f", JSON_SEPARATOR(), precision, (double)number);
+    }
+    firstItem = 0;
+}
+
+void jsonBool(const char *key, uint8_t logic)
+{
+    if (key)
+    {
+        jsonPrint("%s\"%s\":%c", JSON_SEPARATOR(), key, logic ? '1' : '0');
+    }
+    else
+    {
+        jsonPrint("%s%c", JSON_SEPARATOR(), logic ? '1' : '0');
+    }
+    firstItem = 0;
+}
+
+void jsonNull(const char *key)
+{
+    if (key)
+    {
+        jsonPrint("%s\"%s\":null", JSON_SEPARATOR(), key);
+    }
+    else
+    {
+        jsonPrint("%snull", JSON_SEPARATOR());
+    }
+    firstItem = 0;
+}
+
+/** @} */
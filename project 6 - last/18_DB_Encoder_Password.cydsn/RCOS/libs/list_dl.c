@@ -0,0 +1,244 @@
+/**
+ *  @file       list_dl.c
+ *  @brief      Doubly linked list functions
+ *  @copyright  (c) 2018-Arcelik - All Rights Reserved
+ *  @date       17.10.2026
+ */
+#define FILE_LIST_DL_C
+
+#include "list_dl.h"
+#include "libs.h"
+
+/** @addtogroup LIST_DL
+ *  @{
+ */
+
+/// @brief  Check if item is connected to list by walking to its head
+static teBool ldlContains(tsLdl *list, tsLdlItem *item)
+{
+    if ((NULL == item) || (NULL == list->head))
+    {
+        return FALSE;
+    }
+
+    return (ldlHeadFrom(item) == list->head) ? TRUE : FALSE;
+}
+
+void ldlInsertAfter(tsLdl *list, void *item, void *newItem)
+{
+    tsLdlItem *target = item;
+    tsLdlItem *insert = newItem;
+
+    if ((NULL == target) || (TRUE == ldlContains(list, insert)))
+    {
+        return;
+    }
+
+    insert->head = target;
+    insert->tail = target->tail;
+    if (target->tail)
+    {
+        target->tail->head = insert;
+    }
+    else
+    {
+        list->tail = insert;
+    }
+    target->tail = insert;
+    list->count++;
+}
+
+void ldlInsertBefore(tsLdl *list, void *item, void *newItem)
+{
+    tsLdlItem *target = item;
+    tsLdlItem *insert = newItem;
+
+    if ((NULL == target) || (TRUE == ldlContains(list, insert)))
+    {
+        return;
+    }
+
+    insert->tail = target;
+    insert->head = target->head;
+    if (target->head)
+    {
+        target->head->tail = insert;
+    }
+    else
+    {
+        list->head = insert;
+    }
+    target->head = insert;
+    list->count++;
+}
+
+void ldlInsertHead(tsLdl *list, void *newItem)
+{
+    tsLdlItem *insert = newItem;
+
+    if (TRUE == ldlContains(list, insert))
+    {
+        return;
+    }
+
+    if (list->head)
+    {
+        ldlInsertBefore(list, list->head, insert);
+        return;
+    }
+
+    insert->head = NULL;
+    insert->tail = NULL;
+    list->head   = insert;
+    list->tail   = insert;
+    list->count  = 1;
+}
+
+void ldlInsertTail(tsLdl *list, void *newItem)
+{
+    tsLdlItem *insert = newItem;
+
+    if (TRUE == ldlContains(list, insert))
+    {
+        return;
+    }
+
+    if (list->tail)
+    {
+        ldlInsertAfter(list, list->tail, insert);
+        return;
+    }
+
+    insert->head = NULL;
+    insert->tail = NULL;
+    list->head   = insert;
+    list->tail   = insert;
+    list->count  = 1;
+}
+
+void ldlDelete(tsLdl *list, void *item)
+{
+    tsLdlItem *target = item;
+
+    if (FALSE == ldlContains(list, target))
+    {
+        return;
+    }
+
+    if (target->head)
+    {
+        target->head->tail = target->tail;
+    }
+    else
+    {
+        list->head = target->tail;
+    }
+
+    if (target->tail)
+    {
+        target->tail->head = target->head;
+    }
+    else
+    {
+        list->tail = target->head;
+    }
+
+    target->head = NULL;
+    target->tail = NULL;
+    list->count--;
+}
+
+void *ldlPopHead(tsLdl *list)
+{
+    tsLdlItem *item = list->head;
+
+    ldlDelete(list, item);
+
+    return item;
+}
+
+void *ldlPopTail(tsLdl *list)
+{
+    tsLdlItem *item = list->tail;
+
+    ldlDelete(list, item);
+
+    return item;
+}
+
+void *ldlHeadFrom(void *item)
+{
+    tsLdlItem *walk = item;
+
+    while (walk && walk->head)
+    {
+        walk = walk->head;
+    }
+
+    return walk;
+}
+
+void *ldlTailFrom(void *item)
+{
+    tsLdlItem *walk = item;
+
+    while (walk && walk->tail)
+    {
+        walk = walk->tail;
+    }
+
+    return walk;
+}
+
+uint32_t ldlRecount(tsLdl *list)
+{
+    tsLdlItem *item;
+    uint32_t count = 0;
+
+    LIST_DL_FOREACH(item, list)
+    {
+        count++;
+    }
+    list->count = count;
+
+    return count;
+}
+
+void *ldlItemAtIdx(tsLdl *list, uint32_t idx)
+{
+    tsLdlItem *item;
+
+    LIST_DL_FOREACH(item, list)
+    {
+        if (0 == idx--)
+        {
+            return item;
+        }
+    }
+
+    return NULL;
+}
+
+uint32_t ldlIdxOfItem(tsLdl *list, void *item)
+{
+    tsLdlItem *walk;
+    uint32_t idx = 0;
+
+    LIST_DL_FOREACH(walk, list)
+    {
+        if (walk == item)
+        {
+            return idx;
+        }
+        idx++;
+    }
+
+    return (uint32_t)-1;
+}
+
+void addListdlVersion()
+{
+    ADD_RCOS_VERSION("libs/list_dl", "1.0.0")
+}
+
+/** @} */
@@ -0,0 +1,166 @@
+/**
+ *  @file       list_sl.c
+ *  @brief      Singly linked list functions
+ *  @copyright  (c) 2018-Arcelik - All Rights Reserved
+ *  @date       17.10.2026
+ */
+#define FILE_LIST_SL_C
+
+#include "list_sl.h"
+#include "libs.h"
+
+/** @addtogroup LIST_SL
+ *  @{
+ */
+
+/// @brief  Find the item that points to target, list itself is returned for the first item
+static tsLslItem *lslPrevious(tsLsl *list, tsLslItem *item)
+{
+    tsLslItem *walk = (tsLslItem *)list; // tsLsl starts with a next pointer
+
+    while (walk->next)
+    {
+        if (walk->next == item)
+        {
+            return walk;
+        }
+        walk = walk->next;
+    }
+
+    return NULL;
+}
+
+void lslInsertAfter(tsLsl *list, void *item, void *newItem)
+{
+    tsLslItem *target = item;
+    tsLslItem *insert = newItem;
+
+    if ((NULL == target) || (NULL == insert) || lslPrevious(list, insert))
+    {
+        return;
+    }
+
+    insert->next = target->next;
+    target->next = insert;
+    list->count++;
+}
+
+void lslInsertBefore(tsLsl *list, void *item, void *newItem)
+{
+    tsLslItem *previous = lslPrevious(list, item);
+
+    if (previous)
+    {
+        lslInsertAfter(list, previous, newItem);
+    }
+}
+
+void lslInsertHead(tsLsl *list, void *newItem)
+{
+    lslInsertAfter(list, (tsLslItem *)list, newItem);
+}
+
+void lslInsertTail(tsLsl *list, void *newItem)
+{
+    lslInsertAfter(list, lslTailFrom(list), newItem);
+}
+
+void lslDelete(tsLsl *list, void *item)
+{
+    tsLslItem *target   = item;
+    tsLslItem *previous = lslPrevious(list, target);
+
+    if (previous)
+    {
+        previous->next = target->next;
+        target->next   = NULL;
+        list->count--;
+    }
+}
+
+void *lslPopHead(tsLsl *list)
+{
+    tsLslItem *item = list->next;
+
+    lslDelete(list, item);
+
+    return item;
+}
+
+void *lslPopTail(tsLsl *list)
+{
+    tsLslItem *item = lslTailFrom(list);
+
+    if (item == (tsLslItem *)list)
+    {
+        return NULL;
+    }
+    lslDelete(list, item);
+
+    return item;
+}
+
+void *lslTailFrom(void *item)
+{
+    tsLslItem *walk = item;
+
+    while (walk && walk->next)
+    {
+        walk = walk->next;
+    }
+
+    return walk;
+}
+
+uint32_t lslRecount(tsLsl *list)
+{
+    tsLslItem *item;
+    uint32_t count = 0;
+
+    LIST_SL_FOREACH(item, list)
+    {
+        count++;
+    }
+    list->count = count;
+
+    return count;
+}
+
+void *lslItemAtIdx(tsLsl *list, uint32_t idx)
+{
+    tsLslItem *item;
+
+    LIST_SL_FOREACH(item, list)
+    {
+        if (0 == idx--)
+        {
+            return item;
+        }
+    }
+
+    return NULL;
+}
+
+uint32_t lslIdxOfItem(tsLsl *list, void *item)
+{
+    tsLslItem *walk;
+    uint32_t idx = 0;
+
+    LIST_SL_FOREACH(walk, list)
+    {
+        if (walk == item)
+        {
+            return idx;
+        }
+        idx++;
+    }
+
+    return (uint32_t)-1;
+}
+
+void addListslVersion()
+{
+    ADD_RCOS_VERSION("libs/list_sl", "1.0.0")
+}
+
+/** @} */
@@ -0,0 +1,60 @@
+/**
+ *  @file       pool.c
+ *  @brief      Generic structures and functions to create fixed-block memory pools
+ *  @copyright  (c) 2026-Arcelik - All Rights Reserved
+ *  @date       17.10.2026
+ */
+#define FILE_POOL_C
+
+#include "pool.h"
+#include "libs.h"
+
+/** @addtogroup POOL
+ *  @{
+ */
+
+void *poolAlloc(tsPool *pool)
+{
+    void *block = pool->free;
+
+    if (block)
+    {
+        pool->free = *(void **)block;
+    }
+    else if (pool->used < pool->count)
+    {
+        block = &pool->buffer[(uint32_t)pool->used * pool->blockSize];
+        pool->used++;
+    }
+    else
+    {
+        return NULL;
+    }
+
+    pool->available--;
+
+    return block;
+}
+
+void poolFree(tsPool *pool, void *block)
+{
+    if (NULL == block)
+    {
+        return;
+    }
+
+    *(void **)block = pool->free;
+    pool->free      = block;
+    pool->available++;
+}
+
+uint8_t poolContains(const tsPool *pool, const void *block)
+{
+    uint32_t offset = (uint32_t)((const uint8_t *)block - pool->buffer);
+
+    return ((const uint8_t *)block >= pool->buffer) &&
+           (offset < (uint32_t)pool->count * pool->blockSize) &&
+           (0 == (offset % pool->blockSize));
+}
+
+/** @} */
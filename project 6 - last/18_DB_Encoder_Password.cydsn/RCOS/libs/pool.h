@@ -0,0 +1,123 @@
+/**
+ *  @file       pool.h
+ *  @brief      Generic structures and functions to create fixed-block memory pools
+ *  @copyright  (c) 2026-Arcelik - All Rights Reserved
+ *  @date       17.10.2026
+ */
+#ifndef FILE_POOL_H
+#define FILE_POOL_H
+
+/** @addtogroup LIBS
+ *  @{
+ *      @defgroup   POOL POOL
+ *      @brief      Creates and manages a buffer area divided into equal sized blocks.
+ *      @details    Allocation and release take constant time and never fragment the area.
+ *                  Blocks are given out from the untouched part of the area first, released blocks are kept on a
+ *                  free list inside the blocks themselves so no initialization is needed.
+ *                  Functions are not protected against interrupts.
+ *                  Usage:
+ *                  @code
+ *                      POOL_CREATE( framePool, 8, 64 );
+ *                      ...
+ *                      main()
+ *                      {
+ *                          ...
+ *                          uint8_t *frame = poolAlloc( &framePool );
+ *                          if ( frame )
+ *                          {
+ *                              ...
+ *                              poolFree( &framePool, frame );
+ *                          }
+ *                      }
+ *                  @endcode
+ *      @{
+ */
+
+#include <stdint.h>
+
+#ifndef FILE_POOL_C
+#define INTERFACE extern
+#else
+#define INTERFACE
+#endif
+
+/*********************************************************************
+ *  EXPORTED TYPEDEFS
+ */
+/// Structure definition of a POOL object
+typedef struct
+{
+    uint8_t *buffer;    ///< Location of buffer
+    void *free;         ///< First released block, each released block holds address of next one
+    uint16_t blockSize; ///< Size of a block, multiple of pointer size
+    uint16_t count;     ///< Total number of blocks
+    uint16_t used;      ///< Number of blocks given out from the untouched part of buffer
+    uint16_t available; ///< Number of blocks that can be allocated
+} tsPool;
+
+/*********************************************************************
+ *  EXPORTED MACROS
+ */
+
+/// @brief  Size of a pool block that can hold _size bytes, blocks are aligned to pointers
+#define POOL_BLOCK_SIZE(_size) ((((_size) + sizeof(void *) - 1) / sizeof(void *)) * sizeof(void *))
+
+/// @brief  Fill a tsPool object with inital data
+#define POOL_INIT(_array, _count, _size)               \
+    {                                                  \
+        .buffer    = (uint8_t *)(_array),              \
+        .free      = NULL,                             \
+        .blockSize = (uint16_t)POOL_BLOCK_SIZE(_size), \
+        .count     = (_count),                         \
+        .used      = 0,                                \
+        .available = (_count),                         \
+    }
+
+/** @brief  Create a pool object with name and a buffer area for _count blocks of _size bytes
+ *  @param  _name   Name of pool object
+ *  @param  _count  Number of blocks
+ *  @param  _size   Size of each block in bytes
+ */
+#define POOL_CREATE(_name, _count, _size)                                      \
+    void *_name##Buffer[(_count) * (POOL_BLOCK_SIZE(_size) / sizeof(void *))]; \
+    tsPool _name = POOL_INIT(_name##Buffer, _count, _size);
+
+/// @brief  Return number of blocks that can be allocated
+#define POOL_FREE(_poolPtr) ((_poolPtr)->available)
+/// @brief  Expression to check if all blocks are allocated
+#define POOL_IS_EMPTY(_poolPtr) (!((_poolPtr)->available))
+
+/*********************************************************************
+ *  EXPORTED VARIABLES
+ */
+
+/*********************************************************************
+ *  EXPORTED FUNCTION PROTOTYPES
+ */
+
+/** @brief  Take a block from pool
+ *  @param  pool    Pool pointer
+ *  @return Pointer to block, NULL if all blocks are in use
+ */
+INTERFACE void *poolAlloc(tsPool *pool);
+
+/** @brief      Give a block back to its pool
+ *  @warning    Block must have been allocated from the same pool and must not be used afterwards
+ *  @param      pool    Pool pointer
+ *  @param      block   Block pointer, NULL is ignored
+ */
+INTERFACE void poolFree(tsPool *pool, void *block);
+
+/** @brief  Check if an address is a block of the pool
+ *  @param  pool    Pool pointer
+ *  @param  block   Address to check
+ *  @return 1 if address is the start of one of the blocks, 0 otherwise
+ */
+INTERFACE uint8_t poolContains(const tsPool *pool, const void *block);
+
+#undef INTERFACE
+
+/**     @} */
+/** @} */
+
+#endif // FILE_POOL_H
@@ -58,38 +58,128 @@
  *                          break;
  *                  }
  *              @endcode
+ *
+ *              A tsTvmQueue can be given to a ticket vending machine with TVM_QUEUE_SET while nobody holds a ticket.
+ *              Tickets then wait in the queue and TICKET_REMOVE gives the resource to the waiting ticket of the most
+ *              urgent class instead of the next number, and only that ticket holder is woken:
+ *              @code
+ *                  TVM_QUEUE_CREATE(spiQueue, 8, 50)               // 8 waiters, a class up after 50 ticks of wait
+ *                  ...
+ *                  TVM_QUEUE_SET(spiSys.tvm, spiQueue);
+ *                  ...
+ *                  // Inside a protothread
+ *                  ticket = devComTicketGetPriority(&spi, eTicketUrgent, EVENT_PT);
+ *                  PT_WAIT_TICKET(spiSys.tvm, ticket);             // Sleeps until its ticket is up
+ *              @endcode
  *  @warning    don't get more tickets than needed but get a ticket for every process
+ *  @warning    TICKET_IS_DONE is only meaningful for a ticket that was up once when a queue is used
  *  @warning    max ticket count is limited by the size of tTicket and is not checked
  *  @todo       implement multiple ticket for a single process
  *  @{
  */
 
+/** @brief      Wait queues of ticket vending machines, 0 keeps tsTvm as it was before wait queues
+ *  @details    Drivers in prebuilt platform archives embed tsTvm in their system objects, a project that links such an
+ *              archive sets it to 0 so its devices have the layout the drivers were built for. Tickets are then first
+ *              come first served and tvmGet ignores its class.
+ */
+#ifndef TVM_QUEUE
+#define TVM_QUEUE (1)
+#endif
+
 /// @brief  Ticket typedef
 typedef uint16_t tTicket;
 
+/// @brief  Priority class of a ticket, tickets of a lower class are up first when a queue is used
+typedef enum
+{
+    eTicketUrgent = 0, ///< Latency critical short transactions
+    eTicketNormal,     ///< Class of TICKET_GET
+    eTicketBulk,       ///< Long transactions like page programs that can wait
+    eTicketClasses,    ///< Number of classes
+} teTicketClass;
+
+/// @brief  Ticket waiting in a tsTvmQueue
+typedef struct
+{
+    uint32_t since;  ///< Tick count when ticket is taken
+    tTicket ticket;  ///< Waiting ticket
+    uint8_t prio;    ///< teTicketClass
+    uint8_t process; ///< tProcessEnum of holder
+    uint8_t event;   ///< tEventEnum posted with the ticket when it is up, EVENT_PT wakes protothread, EVENT_NONE polls
+    uint8_t slot;    ///< Protothread slot of holder
+} tsTvmWaiter;
+
+/// @brief  Wait time statistics of a ticket class
+typedef struct
+{
+    uint32_t count;    ///< Tickets that were up
+    uint32_t total;    ///< Sum of wait times in ticks
+    uint32_t max;      ///< Longest wait time in ticks
+    uint32_t promoted; ///< Tickets that went ahead of their class by starvation protection
+} tsTvmStats;
+
+/// @brief  Optional wait queue of a ticket vending machine
+typedef struct
+{
+    tsTvmWaiter *waiters;             ///< Waiting tickets
+    uint8_t size;                     ///< Number of waiters
+    uint8_t count;                    ///< Number of waiting tickets
+    uint16_t aging;                   ///< Wait time in ticks that moves a ticket one class up, 0 to disable
+    tTicket overflowFirst;            ///< First of tickets taken while waiters was full
+    uint16_t overflowCount;           ///< Number of tickets taken while waiters was full, they are up in order
+    uint32_t overflows;               ///< Total number of tickets that did not fit into waiters
+    tsTvmStats stats[eTicketClasses]; ///< Wait time statistics of each class
+} tsTvmQueue;
+
 /// @brief  Ticket vending machine
 typedef struct
 {
-    tTicket current; ///< Current ticket that is processed
-    tTicket next;    ///< Next ticket to give out
+    tTicket current;   ///< Current ticket that is processed
+    tTicket next;      ///< Next ticket to give out
+#if TVM_QUEUE
+    tsTvmQueue *queue; ///< Optional wait queue, NULL for first come first served
+#endif
 } tsTvm;
 
+#if TVM_QUEUE
 /// @brief  Initial value for every ticket vending machine
+#define TVM_INIT()  {0, 0, NULL}
+/// @brief  Wait queue of _tvm, NULL for first come first served
+#define TVM_QUEUE_OF(_tvm) ((_tvm).queue)
+/// @brief  Give _queue to _tvm, only while nobody holds a ticket
+#define TVM_QUEUE_SET(_tvm, _queue) ((_tvm).queue = &(_queue))
+#else
 #define TVM_INIT()  {0, 0}
+#define TVM_QUEUE_OF(_tvm) ((tsTvmQueue *)NULL)
+#endif
+
+/** @brief  Create a wait queue for a ticket vending machine
+ *  @param  _name   Name of queue object
+ *  @param  _size   Largest number of waiting tickets, tickets beyond it are up in order after the others
+ *  @param  _aging  Wait time in ticks that moves a ticket one class up to prevent starvation, 0 to disable
+ */
+#define TVM_QUEUE_CREATE(_name, _size, _aging) \
+    tsTvmWaiter _name##Waiters[_size];         \
+    tsTvmQueue _name = {_name##Waiters, (_size), 0, (_aging), 0, 0, 0, {{0}}};
 
 /// @brief  Get a ticket from _tvm
-#define TICKET_GET(_tvm) ((_tvm).next++)
+#define TICKET_GET(_tvm) (TVM_QUEUE_OF(_tvm) ? tvmGet(&(_tvm), eTicketNormal, 0) : (_tvm).next++)
 /// @brief  Check if your _ticket is ready on _tvm
 #define TICKET_IS_UP(_tvm, _ticket) ((_tvm).current == (_ticket))
 /// @brief  Check if your _ticket is done on _tvm
 #define TICKET_IS_DONE(_tvm, _ticket) ((_tvm).current != (_ticket))
 /// @brief  Remove a ticket from _tvm
-#define TICKET_REMOVE(_tvm)                \
-    {                                      \
-        if ((_tvm).current != (_tvm).next) \
-        {                                  \
-            (_tvm).current++;              \
-        }                                  \
+#define TICKET_REMOVE(_tvm)                     \
+    {                                           \
+        if (TVM_QUEUE_OF(_tvm))                 \
+        {                                       \
+            tvmRemove(&(_tvm));                 \
+        }                                       \
+        else if ((_tvm).current != (_tvm).next) \
+        {                                       \
+            (_tvm).current++;                   \
+        }                                       \
     }
 
 /** @} */
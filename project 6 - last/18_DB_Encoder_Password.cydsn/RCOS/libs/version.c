@@ -0,0 +1,21 @@
+/**
+ *  @file       version.c
+ *  @brief      Version control functions
+ *  @copyright  (c) 2018-Arcelik - All Rights Reserved
+ *  @date       17.10.2026
+ */
+#define FILE_VERSION_C
+
+#include "version.h"
+#include "libs.h"
+
+/** @addtogroup VERSION
+ *  @{
+ */
+
+void addVersionItem(tsLsl *versionList, tsVersionListItem *newCompVersion)
+{
+    lslInsertTail(versionList, newCompVersion); // Already registered items are ignored
+}
+
+/** @} */
@@ -0,0 +1,111 @@
+/** @file       buttons.c
+ *  @brief      Buttons middleware to convert devIo values into pressed/released events
+ *  @copyright  (c) 2019-Arcelik - All Rights Reserved
+ *              Permission to use, reproduce, copy, prepare derivative works,
+ *              modify, distribute, perform, display or sell this software and/or
+ *              its documentation for any purpose is prohibited without the express
+ *              written consent of Arcelik A.S.
+ *  @date       17.10.2026
+ */
+#define FILE_BUTTONS_C
+
+#include "buttons.h"
+
+/** @addtogroup BUTTONS
+ *  @{
+ */
+
+/// @brief  Buttons process does not handle events, every work is done in its thread
+static PROCESS_HANDLER_PROTO(buttonsHandler)
+{
+    UNUSED(process);
+}
+
+/// @brief  Poll buttonsDevIo every resolution period and post mapped events
+static PT_THREAD(buttonsThread)
+{
+    tsButtonsParams *params       = process->parameters;
+    const tsButtonsConsts *consts = process->constants;
+    uint32_t value;
+    uint8_t idx;
+
+    PT_BEGIN();
+
+    for (;;)
+    {
+        value = devIoGet(consts->buttonsDevIo);
+
+        if (value == params->lastValue)
+        {
+            if (params->lastIdx != consts->mapSize)
+            {
+                params->time += consts->resolution;
+                if (consts->map[params->lastIdx].pressed)
+                {
+                    eventPost(params->targetProcess, consts->map[params->lastIdx].pressed, &params->time, sizeof(params->time));
+                }
+            }
+        }
+        else if ((value ^ params->lastValue) & value)
+        {
+            // New buttons are pressed
+            params->lastIdx = consts->mapSize;
+            params->time    = 0;
+            for (idx = 0; idx < consts->mapSize; idx++)
+            {
+                if (consts->map[idx].buttonsValue == value)
+                {
+                    params->lastIdx = idx;
+                    if (consts->map[idx].pressed)
+                    {
+                        eventPost(params->targetProcess, consts->map[idx].pressed, &params->time, sizeof(params->time));
+                    }
+                    break;
+                }
+            }
+            params->lastValue = value;
+        }
+        else
+        {
+            // Buttons are released
+            if ((params->lastIdx != consts->mapSize) && consts->map[params->lastIdx].released)
+            {
+                eventPost(params->targetProcess, consts->map[params->lastIdx].released, &params->time, sizeof(params->time));
+            }
+            params->lastIdx   = consts->mapSize;
+            params->time      = 0;
+            params->lastValue = value;
+        }
+
+        PT_YIELD_TIMEOUT(consts->resolution);
+    }
+
+    PT_END();
+}
+
+/// @brief  Initialization function of buttons process
+PROCESS_INIT_PROTO(buttonsInit)
+{
+    tsButtonsParams *params       = process->parameters;
+    const tsButtonsConsts *consts = process->constants;
+
+    ADD_RCOS_VERSION("mw/buttons", "1.0.0")
+
+    PROCESS_STATE_CHANGE(process, buttonsHandler);
+    devIoInit(consts->buttonsDevIo, NULL);
+    params->lastValue = devIoGet(consts->buttonsDevIo);
+    threadStart(process, buttonsThread);
+
+    process->initialized = 1;
+}
+
+/// @brief  Deinitialization function of buttons process
+PROCESS_DEINIT_PROTO(buttonsDeinit)
+{
+    threadStop(process, buttonsThread);
+    PROCESS_STATE_CHANGE(process, NULL);
+
+    process->initialized = 0;
+}
+
+/** @} */
@@ -35,6 +35,9 @@ INTERFACE CMD_PROTO(cmdEcho);
 /// @brief  Key test command object
 INTERFACE CMD_PROTO(cmdKeyTest);
 
+/// @brief  RAM high-water marks command object, see cli_ram.c
+INTERFACE CMD_PROTO(cmdRam);
+
 /** @} */
 
 #undef INTERFACE // Should not let this roam free
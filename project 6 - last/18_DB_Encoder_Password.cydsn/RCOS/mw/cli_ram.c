@@ -0,0 +1,44 @@
+/** @file       cli_ram.c
+ *  @brief      CLI command to print RAM high-water marks
+ *  @copyright  (c) 2026-Arcelik - All Rights Reserved
+ *              Permission to use, reproduce, copy, prepare derivative works,
+ *              modify, distribute, perform, display or sell this software and/or
+ *              its documentation for any purpose is prohibited without the express
+ *              written consent of Arcelik A.S.
+ *  @date       17.10.2026
+ */
+#include "cli_cmds.h"
+
+/** @addtogroup CLI_CMDS
+ *  @{
+ */
+
+/// @brief  Free transmit space waited before each line of ram command
+#define CMD_RAM_LINE (64u)
+
+CMD_FUNC(cmdRam, "ram", "RAM high-water marks", "ram\r\n  Size and highest usage in bytes of stack, event queues, deques and registered buffers, see WATERMARK")
+{
+    static uint16_t idx; ///< Area to print, kept between protothread calls
+    tsWatermarkMark mark;
+
+    CMD_BEGIN();
+
+    CMD_PRINT("%-16s %8s %8s %4s\r\n", "area", "size", "peak", "%");
+    for (idx = 0; EXIT_SUCCESS == watermarkGet(idx, &mark); idx++)
+    {
+        PT_WAIT_UNTIL(devComSend(consts->uart, NULL, 0) >= CMD_RAM_LINE);
+        watermarkGet(idx, &mark); // Mark is a local, it is lost while waiting
+
+        CMD_PRINT("%-16s %8lu %8lu %3lu%%", mark.name, (unsigned long)mark.size, (unsigned long)mark.peak,
+                  mark.size ? (unsigned long)((uint64_t)mark.peak * 100u / mark.size) : 0ul);
+        if (eWatermarkQueue == mark.kind)
+        {
+            CMD_PRINT(" process %u events %u signals %u", mark.process, mark.events, mark.signals);
+        }
+        CMD_PRINT("\r\n");
+    }
+
+    CMD_END();
+}
+
+/** @} */
@@ -20,7 +20,7 @@
 
 #include "rcos.h"
 
-/// If enabled allows multiple posts but reduces performance
+/// If enabled allows multiple posts but reduces performance, prefer core TOPICS for one-to-many delivery
 #define EVENT_MAPPER_MULTI_EVENTPOSTS DISABLE
 
 /// @brief  Single event mapper item that is used for redirection
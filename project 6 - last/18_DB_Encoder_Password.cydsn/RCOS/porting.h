@@ -70,6 +70,8 @@ uint16_t htons(uint16_t data);
 #include "dev/psoc6/platform.h"
 #elif defined RCOS_PLATFORM_AVR_DA
 #include "dev/avr_da/platform.h"
+#elif defined RCOS_PLATFORM_HOST
+#include "dev/host/platform.h"
 #endif
 
 #endif // FILE_PORTING_H
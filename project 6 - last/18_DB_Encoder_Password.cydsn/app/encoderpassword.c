@@ -129,6 +129,7 @@ PROCESS_INIT_PROTO(encoderPasswordInit)
     const tsEncoderPasswordConsts *consts = process->constants;
 
     PROCESS_STATE_CHANGE(process, encoderPasswordInitialStateHandler);
+    UNUSED(encoderPasswordLockingStateHandler); // REMOVE IF p71Released locking flow is enabled again
     eventPost(process->enumeration, eEPEventUIUpdate, NULL, 0);
 
     devIoInit(consts->redLed, NULL);
@@ -155,7 +156,7 @@ PROCESS_DEINIT_PROTO(encoderPasswordDeinit)
     UNUSED(consts); // REMOVE IF USED
 
     PROCESS_STATE_CHANGE(process, NULL);
-    threadStop(process, process->threadFunction);
+    threadStop(process, encoderPasswordThread);
     process->initialized = 0; // If process needs other checks, clear this another time
 }
 
@@ -172,7 +173,7 @@ static PROCESS_HANDLER_PROTO(encoderPasswordInitialStateHandler)
     {
         case eEPEventUIUpdate: 
         {
-            devIoPut(consts->buzzer, (uint32_t)buttonPress);
+            devIoPut(consts->buzzer, (uint32_t)(uintptr_t)buttonPress);
 
             devIoPut(consts->redLed, 0);
             devIoPut(consts->blueLed, 0);
@@ -249,7 +250,7 @@ static PROCESS_HANDLER_PROTO(encoderPasswordInitialStateHandler)
         {
             //devComSend(consts->uart, myMessage, sizeof(myMessage));
             //params->timerUIGeneral.post.event = p70Released;
-            /*devIoPut(consts->buzzer, (uint32_t)buttonPress);
+            /*devIoPut(consts->buzzer, (uint32_t)(uintptr_t)buttonPress);
             
             devIoPut(consts->redLed, 1);
             devIoPut(consts->blueLed, 0);
@@ -266,11 +267,11 @@ static PROCESS_HANDLER_PROTO(encoderPasswordInitialStateHandler)
             params->timerUIGeneral.post.event = p46Released;
 
             if((consts->sevenSegmentDisplay, devIoGet(consts->encoder)) == 1)
-             devIoPut(consts->buzzer, (uint32_t)encoder1);
+             devIoPut(consts->buzzer, (uint32_t)(uintptr_t)encoder1);
             if((consts->sevenSegmentDisplay, devIoGet(consts->encoder)) == 2)
-             devIoPut(consts->buzzer, (uint32_t)encoder2);
+             devIoPut(consts->buzzer, (uint32_t)(uintptr_t)encoder2);
             if((consts->sevenSegmentDisplay, devIoGet(consts->encoder)) == 3)
-             devIoPut(consts->buzzer, (uint32_t)encoder3);
+             devIoPut(consts->buzzer, (uint32_t)(uintptr_t)encoder3);
             
             devIoPut(consts->sevenSegmentDisplay, devIoGet(consts->encoder));
             
@@ -290,7 +291,7 @@ static PROCESS_HANDLER_PROTO(encoderPasswordInitialStateHandler)
             params->timerUIGeneral.post.event = p70Released;
             */
             
-        /*devIoPut(consts->buzzer, (uint32_t)buttonPress);
+        /*devIoPut(consts->buzzer, (uint32_t)(uintptr_t)buttonPress);
             
             devIoPut(consts->redLed, 0);
             devIoPut(consts->blueLed, 1);
@@ -308,7 +309,7 @@ static PROCESS_HANDLER_PROTO(encoderPasswordInitialStateHandler)
             //params->timerUIGeneral.post.event = p70Released;
             
             
-            /*devIoPut(consts->buzzer, (uint32_t)buttonPress);
+            /*devIoPut(consts->buzzer, (uint32_t)(uintptr_t)buttonPress);
             timerEventStop(&(params->timerUIGeneral));
             
             PROCESS_STATE_CHANGE(process, encoderPasswordLockingStateHandler);
@@ -318,7 +319,7 @@ static PROCESS_HANDLER_PROTO(encoderPasswordInitialStateHandler)
             params->password = 0;           ///< clear password
             eventPost(process->enumeration, eEPEventUIUpdate, NULL, 0);*/
             
-            /*devIoPut(consts->buzzer, (uint32_t)buttonPress);
+            /*devIoPut(consts->buzzer, (uint32_t)(uintptr_t)buttonPress);
             
             devIoPut(consts->redLed, 0);
             devIoPut(consts->blueLed, 0);
@@ -377,7 +378,7 @@ static PROCESS_HANDLER_PROTO(encoderPasswordLockingStateHandler)
                 params->lockingState = 1;
                 ///< change state
 
-                devIoPut(consts->buzzer, (uint32_t)locked);
+                devIoPut(consts->buzzer, (uint32_t)(uintptr_t)locked);
 
                 timerEventStop(&(params->timerUIGeneral));
             
@@ -391,14 +392,14 @@ static PROCESS_HANDLER_PROTO(encoderPasswordLockingStateHandler)
             }
             else
             {
-                devIoPut(consts->buzzer, (uint32_t)buttonPress);
+                devIoPut(consts->buzzer, (uint32_t)(uintptr_t)buttonPress);
             }
         }
         break;
 
         case p71Released:
         {
-            devIoPut(consts->buzzer, (uint32_t)buttonPress);
+            devIoPut(consts->buzzer, (uint32_t)(uintptr_t)buttonPress);
 
             params->passwordIndex = 0;
             params->password = 0;
@@ -469,19 +470,19 @@ static PROCESS_HANDLER_PROTO(encoderPasswordUnLockingStateHandler)
 
                     ///< change state
 
-                    devIoPut(consts->buzzer, (uint32_t)locked);
+                    devIoPut(consts->buzzer, (uint32_t)(uintptr_t)locked);
                 }
             }
             else
             {
-                devIoPut(consts->buzzer, (uint32_t)buttonPress);
+                devIoPut(consts->buzzer, (uint32_t)(uintptr_t)buttonPress);
             }
         }
         break;
 
         case p71Released:
         {
-            devIoPut(consts->buzzer, (uint32_t)buttonPress);
+            devIoPut(consts->buzzer, (uint32_t)(uintptr_t)buttonPress);
 
             params->passwordIndex = 0;
             params->unlockValue = 0;
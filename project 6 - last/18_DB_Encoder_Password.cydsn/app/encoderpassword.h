@@ -95,7 +95,7 @@ typedef struct
         .buzzer = &_buzzer,                                                         \
         .uart = &_uart,                                                            \
     };                                            \
-    PROCESS_CREATE(_name, encoderPasswordInit, encoderPasswordDeinit, _enum, &_name##Params, &_name##Consts)
+    PROCESS_CREATE_COALESCE(_name, encoderPasswordInit, encoderPasswordDeinit, _enum, &_name##Params, &_name##Consts, EVENT_MASK(eEPEventUIUpdate))
 
 /** @} */
 
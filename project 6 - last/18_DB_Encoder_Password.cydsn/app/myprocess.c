@@ -17,7 +17,7 @@
 // #define DEBUG_PORT_
 // DEBUG_START(0)
 
-char myMessage[] = "Hello World - RcOS+ \r\n";
+static char myMessage[] = "Hello World - RcOS+ \r\n";
 
 /**
  *  @addtogroup MYPROCESS
@@ -29,6 +29,9 @@ static PT_THREAD(myProcessThread)
     tsMyProcessParams *params       = process->parameters;
     const tsMyProcessConsts *consts = process->constants;
 
+    UNUSED(params); // REMOVE IF USED
+    UNUSED(consts); // REMOVE IF USED
+
     PT_BEGIN();
 
     for (;;)
@@ -67,7 +70,7 @@ PROCESS_DEINIT_PROTO(myProcessDeinit)
     UNUSED(consts); // REMOVE IF USED
 
     PROCESS_STATE_CHANGE(process, NULL);
-    threadStop(process, process->threadFunction);
+    threadStop(process, myProcessThread);
     
     process->initialized = 0; // If process needs other checks, clear this another time
 }
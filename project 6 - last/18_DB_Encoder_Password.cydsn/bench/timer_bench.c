@@ -0,0 +1,106 @@
+/** @file       timer_bench.c
+ *  @brief      Measures rcosTickIsr cost and number of ticks with an expiry, with a number of armed software timers on
+ *              host platform with and without timer slack
+ *  @copyright  (c) 2026-Arcelik - All Rights Reserved
+ *              Permission to use, reproduce, copy, prepare derivative works,
+ *              modify, distribute, perform, display or sell this software and/or
+ *              its documentation for any purpose is prohibited without the express
+ *              written consent of Arcelik A.S.
+ *  @date       17.10.2026
+ */
+#include "rcos.h"
+#include <stdio.h>
+#include <time.h>
+
+/// @brief  Number of ticks measured for each timer count
+#define BENCH_TICKS (200000ul)
+/// @brief  Largest number of timers used in benchmark
+#define BENCH_TIMERS_MAX (1000)
+
+static void benchTickNone(void)
+{
+}
+
+CORE_EVENTQUEUE_SIZE(1024)
+CORE_TICK_CREATE(benchTickNone, benchTickNone, benchTickNone)
+CORE_WDT_CREATE(benchTickNone, benchTickNone, benchTickNone, 0)
+
+static uint32_t benchCalls;
+static uint32_t benchWakeUps; ///< Ticks that at least one callback expired, each one is a wake-up when tickless
+static uint32_t benchLastTick;
+
+/// @brief  Periodic callback that restarts itself with its own period
+static TIMER_CALLBACK_FUNC(benchCallBack)
+{
+    benchCalls++;
+    if (benchLastTick != rcosTickCount())
+    {
+        benchLastTick = rcosTickCount();
+        benchWakeUps++;
+    }
+
+    return (uint32_t)(uintptr_t)parameter;
+}
+
+static tsTimerCallBack benchTimers[BENCH_TIMERS_MAX];
+
+static uint64_t benchNow(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+/// @brief  Arm count timers with periods spread between 2ms and 60s, then measure tick cost
+static void benchRun(uint32_t count, uint16_t slack)
+{
+    uint64_t start, elapsed;
+    uint32_t seed = 1;
+    uint32_t period;
+    uint32_t idx;
+
+    for (idx = 0; idx < count; idx++)
+    {
+        seed   = seed * 1103515245ul + 12345ul; // Same sequence every run
+        period = 2 + (seed >> 8) % 60000;
+        benchTimers[idx].callBack  = benchCallBack;
+        benchTimers[idx].parameter = (void *)(uintptr_t)period;
+        timerCallBackStartSlack(&benchTimers[idx], period, (uint16_t)MIN(slack, period / 8)); // Never more than 12.5%
+    }
+
+    benchCalls   = 0;
+    benchWakeUps = 0;
+    start      = benchNow();
+    for (idx = 0; idx < BENCH_TICKS; idx++)
+    {
+        hostIsrRun(rcosTickIsr);
+    }
+    elapsed = benchNow() - start;
+
+    printf("timers=%-5u slack=%-3u ticks=%lu callbacks=%-7u wakeups=%-7u ns/tick=%.1f\n",
+           count, slack, BENCH_TICKS, benchCalls, benchWakeUps, (double)elapsed / BENCH_TICKS);
+
+    for (idx = 0; idx < count; idx++)
+    {
+        timerCallBackStop(&benchTimers[idx]);
+    }
+}
+
+int main(void)
+{
+    static const uint32_t counts[] = {0, 10, 100, 1000};
+    uint8_t idx;
+
+    platformInit();
+    coreInit();
+
+    for (idx = 0; idx < ARRAY_SIZE(counts); idx++)
+    {
+        benchRun(counts[idx], 0);
+        benchRun(counts[idx], 64);
+    }
+
+    return 0;
+}
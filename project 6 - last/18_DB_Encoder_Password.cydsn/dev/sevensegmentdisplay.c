@@ -10,7 +10,7 @@
  */
 #define FILE_SEVENSegmentDISPLAY_C
 
-#include "sevenSegmentdisplay.h"
+#include "sevensegmentdisplay.h"
 
 /**
  *  @addtogroup SEVENSEGMENTDISPLAY
@@ -175,7 +175,7 @@ PROCESS_DEINIT_PROTO(sevenSegmentDisplayProcessDeinit)
     UNUSED(consts); // REMOVE IF USED
 
     PROCESS_STATE_CHANGE(process, NULL);
-    threadStop(process, process->threadFunction);
+    threadStop(process, sevenSegmentDisplayThread);
     process->initialized = 0; // If process needs other checks, clear this another time
 }
 
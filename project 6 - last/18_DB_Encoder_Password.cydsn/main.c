@@ -9,12 +9,16 @@
  *
  * ========================================
 */
-#include "project.h"
 #include "rcos.h"
+#if !defined RCOS_PLATFORM_HOST
+#include "project.h"
+#endif
 
 int main(void)
 {
+#if !defined RCOS_PLATFORM_HOST
     CyGlobalIntEnable; /* Enable global interrupts. */
+#endif
 
     rcosMainLoop();
 }
@@ -11,9 +11,17 @@
 #define FILE_RCOS_C
 
 #include "rcos.h"
+#if defined RCOS_PLATFORM_HOST
+#include "dev/host/gpio.h"
+#include "dev/host/capsense.h"
+#include "dev/host/pwm.h"
+#include "dev/host/uart.h"
+#else
 #include "dev/psoc4/gpio.h"
 #include "dev/psoc4/capsense.h"
 #include "dev/psoc4/pwm.h"
+#include "dev/psoc4/uart.h"
+#endif
 #include "mw/buttons.h"
 #include "system.h"
 #include "dev/encoder.h"
@@ -22,7 +30,6 @@
 #include "dev/sevensegmentdisplay.h"
 #include "dev/pattern.h"
 #include "app/encoderpassword.h"
-#include "dev/psoc4/uart.h"
 #include "app/myprocess.h"
 
 #define DEBUG_FILE_NAME "rcos"
@@ -31,6 +38,7 @@
 // DEBUG_START(0)
 
 CORE_EVENTQUEUE_SIZE(1024)
+CORE_PROCESS_TABLE(eProcessCount)
 // CORE_DEBUG_DEV(_devName)
 CORE_TICK_DEFAULT(0)
 CORE_WDT_DEFAULT(0)
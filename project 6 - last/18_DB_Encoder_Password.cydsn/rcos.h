@@ -14,7 +14,11 @@
 /**
  *  RCoS+ configuration
  */
+#if !defined RCOS_PLATFORM_HOST
 #define RCOS_PLATFORM_PSOC4
+#define TVM_QUEUE (0) // Drivers are linked from lib_psoc4_C_2.0.1_L.0.1.6_release, keep the layouts it was built with
+#define DEV_ASYNC (0)
+#endif
 
 #include "rcos_main.h"
 
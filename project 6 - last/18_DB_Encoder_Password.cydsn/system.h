@@ -22,6 +22,7 @@ typedef enum
     eProcessButtons,
     eProcessEncoderPassword,
     eProcessMyProcess,
+    eProcessCount, ///< Number of processes, keep last
 } teSystemProcesses;
 
 #endif // FILE_SYSTEM_H
@@ -0,0 +1,99 @@
+/** @file       test_coalesce.c
+ *  @brief      Checks that a coalescable event without data is merged into the same waiting event, while events with
+ *              data, other events and posts made after the waiting one is taken are handled separately
+ *  @copyright  (c) 2026-Arcelik - All Rights Reserved
+ *              Permission to use, reproduce, copy, prepare derivative works,
+ *              modify, distribute, perform, display or sell this software and/or
+ *              its documentation for any purpose is prohibited without the express
+ *              written consent of Arcelik A.S.
+ *  @date       17.10.2026
+ */
+#include "rcos.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/// @brief  Enumeration of process under test
+#define TEST_PROCESS (1)
+/// @brief  Handled events expected, d marks an event with data
+#define TEST_EXPECTED "1 2d 2d 3 3 2 40 40 1 "
+
+static void testEnd(void);
+
+CORE_EVENTQUEUE_SIZE(256)
+CORE_TICK_CREATE_SIMULATION(1000, testEnd)
+CORE_WDT_DEFAULT(0)
+
+static char testLog[64];
+static uint8_t testLogLength;
+
+static PROCESS_HANDLER_PROTO(testHandler)
+{
+    static teBool reposted = FALSE;
+
+    testLogLength += (uint8_t)snprintf(&testLog[testLogLength], sizeof(testLog) - testLogLength, "%u%s ",
+                                       eventCurrent.event, eventCurrent.length ? "d" : "");
+
+    if ((1 == eventCurrent.event) && (FALSE == reposted))
+    {
+        reposted = TRUE;
+        eventPost(TEST_PROCESS, 1, NULL, 0); // Event being handled is not waiting anymore, this one is queued
+        eventPost(TEST_PROCESS, 1, NULL, 0); // Merged into the one above
+    }
+}
+
+static PROCESS_INIT_PROTO(testInit)
+{
+    process->handlerCurrent = testHandler;
+}
+
+static PROCESS_DEINIT_PROTO(testDeinit)
+{
+}
+
+/// @brief  Event beyond PROCESS_COALESCE_MAX, it has no bit in the mask and it is never merged
+#define TEST_EVENT_HIGH (40)
+
+PROCESS_CREATE_COALESCE(testProcess, testInit, testDeinit, TEST_PROCESS, NULL, NULL, EVENT_MASK(1) | EVENT_MASK(2) | EVENT_MASK(TEST_EVENT_HIGH))
+
+/// @brief  Simulation ends when every event is handled
+static void testEnd(void)
+{
+    uint8_t errors = 0;
+
+    if (strcmp(testLog, TEST_EXPECTED))
+    {
+        printf("handled \"%s\", expected \"%s\"\n", testLog, TEST_EXPECTED);
+        errors++;
+    }
+    if ((3 != testProcess.evCoalesced) || (3 != eventDrops.coalesced))
+    {
+        printf("coalesced process=%u all=%u, expected 3\n", testProcess.evCoalesced, eventDrops.coalesced);
+        errors++;
+    }
+
+    printf("coalesce errors=%u\n", errors);
+    exit(errors ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+
+int main(void)
+{
+    uint8_t data = 0x5a;
+
+    platformInit();
+    coreInit();
+    processStart(&testProcess);
+
+    eventPost(TEST_PROCESS, 1, NULL, 0);
+    eventPost(TEST_PROCESS, 1, NULL, 0);     // Merged
+    eventPost(TEST_PROCESS, 2, &data, 1);    // Events with data are never merged
+    eventPost(TEST_PROCESS, 2, &data, 1);
+    eventPost(TEST_PROCESS, 3, NULL, 0);     // Not coalescable
+    eventPost(TEST_PROCESS, 3, NULL, 0);
+    eventPost(TEST_PROCESS, 1, NULL, 0);     // Merged
+    eventPost(TEST_PROCESS, 2, NULL, 0);     // Only events with data of 2 are waiting, queued
+    eventPost(TEST_PROCESS, TEST_EVENT_HIGH, NULL, 0);
+    eventPost(TEST_PROCESS, TEST_EVENT_HIGH, NULL, 0);
+
+    coreRun();
+}
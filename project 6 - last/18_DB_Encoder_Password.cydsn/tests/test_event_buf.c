@@ -0,0 +1,180 @@
+/** @file       test_event_buf.c
+ *  @brief      Checks reference counting of event buffers, every post that fails or is dropped gives its buffer back to
+ *              the pool once and forwarded or postponed buffers live until their last handler returns
+ *  @copyright  (c) 2026-Arcelik - All Rights Reserved
+ *              Permission to use, reproduce, copy, prepare derivative works,
+ *              modify, distribute, perform, display or sell this software and/or
+ *              its documentation for any purpose is prohibited without the express
+ *              written consent of Arcelik A.S.
+ *  @date       17.10.2026
+ */
+#include "rcos.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/// @brief  Handled events expected as process:event:first byte of buffer
+#define TEST_EXPECTED "4:1:b 5:2:d 1:1:a 2:1:a 2:1:a "
+/// @brief  Number of buffers in pool
+#define TEST_BUFFERS (8)
+/// @brief  Process that does not exist
+#define TEST_MISSING (9)
+
+/// @brief  Process enumerations
+typedef enum
+{
+    eTestSink = 1,   ///< Forwards its buffer to eTestForward
+    eTestForward,    ///< Postpones its buffer once
+    eTestIdle,       ///< Has no handler
+    eTestDropNew,    ///< Quota of a single event that drops new events
+    eTestDropOldest, ///< Quota of a single event that drops old events
+} teTestProcess;
+
+static void testEnd(void);
+
+CORE_EVENTQUEUE_SIZE(256)
+CORE_TICK_CREATE_SIMULATION(100, testEnd)
+CORE_WDT_DEFAULT(0)
+CORE_EVENTBUF_POOL(TEST_BUFFERS, 16)
+
+EVENT_QUOTA_CREATE(testQuotaDropNew, 1, 0, 0, eOverloadDropNew, NULL)
+EVENT_QUOTA_CREATE(testQuotaDropOldest, 1, 0, 0, eOverloadDropOldest, NULL)
+
+static char testLog[64];
+static uint8_t testLogLength;
+static uint8_t testErrors;
+static uint8_t testIsrResult;
+
+/// @brief  Compare a counter or a result with its expected value
+static void testCheck(const char *name, uint32_t value, uint32_t expected)
+{
+    if (value != expected)
+    {
+        printf("%s=%u, expected %u\n", name, value, expected);
+        testErrors++;
+    }
+}
+
+/// @brief  Allocate a buffer that starts with mark
+static void *testBuf(char mark)
+{
+    char *buf = eventBufAlloc(4);
+
+    if (buf)
+    {
+        memset(buf, mark, 4);
+    }
+
+    return buf;
+}
+
+static void testIsrPost(void)
+{
+    testIsrResult = eventPostRef(eTestSink, 1, testBuf('i'), 4);
+}
+
+static PROCESS_HANDLER_PROTO(testHandler)
+{
+    static teBool postponed;
+
+    testLogLength += (uint8_t)snprintf(&testLog[testLogLength], sizeof(testLog) - testLogLength, "%u:%u:%c ",
+                                       process->enumeration, eventCurrent.event, eventBuf ? *(char *)eventBuf : '-');
+
+    if (eTestSink == process->enumeration)
+    {
+        eventBufRetain(eventBuf);
+        testCheck("forwarded", EXIT_SUCCESS == eventPostRef(eTestForward, 1, eventBuf, eventBufLength), TRUE);
+    }
+    else if ((eTestForward == process->enumeration) && (FALSE == postponed))
+    {
+        postponed = TRUE;
+        testCheck("postponed", EXIT_SUCCESS == eventPostPone(), TRUE);
+    }
+}
+
+static PROCESS_INIT_PROTO(testInit)
+{
+    static tsEventQuota *const quotas[] = {NULL, NULL, NULL, &testQuotaDropNew, &testQuotaDropOldest};
+
+    if (eTestIdle != process->enumeration)
+    {
+        process->handlerCurrent = testHandler;
+    }
+    process->quota = quotas[process->enumeration - eTestSink];
+}
+
+static PROCESS_DEINIT_PROTO(testDeinit)
+{
+}
+
+PROCESS_CREATE(testSink, testInit, testDeinit, eTestSink, NULL, NULL)
+PROCESS_CREATE(testForward, testInit, testDeinit, eTestForward, NULL, NULL)
+PROCESS_CREATE(testIdle, testInit, testDeinit, eTestIdle, NULL, NULL)
+PROCESS_CREATE(testDropNew, testInit, testDeinit, eTestDropNew, NULL, NULL)
+PROCESS_CREATE(testDropOldest, testInit, testDeinit, eTestDropOldest, NULL, NULL)
+
+/// @brief  Simulation ends when every event is handled, every buffer must be back in pool exactly once
+static void testEnd(void)
+{
+    void *bufs[TEST_BUFFERS];
+    uint8_t idx;
+    uint8_t other;
+
+    if (strcmp(testLog, TEST_EXPECTED))
+    {
+        printf("handled \"%s\", expected \"%s\"\n", testLog, TEST_EXPECTED);
+        testErrors++;
+    }
+    testCheck("available at end", rcosEventBufPool->available, TEST_BUFFERS);
+
+    for (idx = 0; idx < TEST_BUFFERS; idx++)
+    {
+        bufs[idx] = eventBufAlloc(4);
+        testCheck("allocated", NULL != bufs[idx], TRUE);
+        for (other = 0; other < idx; other++)
+        {
+            testCheck("distinct", bufs[idx] != bufs[other], TRUE); // A buffer released twice is given out twice
+        }
+    }
+    testCheck("exhausted", NULL == eventBufAlloc(4), TRUE);
+
+    printf("event buf errors=%u\n", testErrors);
+    exit(testErrors ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+
+int main(void)
+{
+    platformInit();
+    coreInit();
+    processStart(&testSink);
+    processStart(&testForward);
+    processStart(&testIdle);
+    processStart(&testDropNew);
+    processStart(&testDropOldest);
+
+    testCheck("missing posted", EXIT_SUCCESS == eventPostRef(TEST_MISSING, 1, testBuf('m'), 4), FALSE);
+    testCheck("available after missing", rcosEventBufPool->available, TEST_BUFFERS);
+
+    testCheck("too long posted", EXIT_SUCCESS == eventPostRef(eTestSink, 1, testBuf('l'), 100), FALSE);
+    testCheck("available after too long", rcosEventBufPool->available, TEST_BUFFERS);
+
+    testCheck("no handler posted", EXIT_SUCCESS == eventPostRef(eTestIdle, 1, testBuf('h'), 4), FALSE);
+    testCheck("available after no handler", rcosEventBufPool->available, TEST_BUFFERS);
+
+    hostIsrRun(testIsrPost);
+    testCheck("isr posted", EXIT_SUCCESS == testIsrResult, FALSE);
+    testCheck("available after isr", rcosEventBufPool->available, TEST_BUFFERS);
+
+    testCheck("drop new posted", EXIT_SUCCESS == eventPostRef(eTestDropNew, 1, testBuf('b'), 4), TRUE);
+    testCheck("drop new posted", EXIT_SUCCESS == eventPostRef(eTestDropNew, 2, testBuf('x'), 4), FALSE);
+    testCheck("available after drop new", rcosEventBufPool->available, TEST_BUFFERS - 1);
+
+    testCheck("drop oldest posted", EXIT_SUCCESS == eventPostRef(eTestDropOldest, 1, testBuf('c'), 4), TRUE);
+    testCheck("drop oldest posted", EXIT_SUCCESS == eventPostRef(eTestDropOldest, 2, testBuf('d'), 4), TRUE);
+    testCheck("available after drop oldest", rcosEventBufPool->available, TEST_BUFFERS - 2);
+
+    testCheck("sink posted", EXIT_SUCCESS == eventPostRef(eTestSink, 1, testBuf('a'), 4), TRUE);
+    testCheck("available before run", rcosEventBufPool->available, TEST_BUFFERS - 3);
+
+    coreRun();
+}
@@ -0,0 +1,254 @@
+/** @file       test_executor.c
+ *  @brief      Checks that posts to another executor group run on its thread in posted order and that event buffers
+ *              of posts lost on the way, a full ring, a quota of the destination or a full ring of a topic copy, are
+ *              given back to the pool exactly once
+ *  @details    Consumer thread is held in its handler while the ring of its group is filled, so the number of posts
+ *              that fit does not depend on thread timing.
+ *  @copyright  (c) 2026-Arcelik - All Rights Reserved
+ *              Permission to use, reproduce, copy, prepare derivative works,
+ *              modify, distribute, perform, display or sell this software and/or
+ *              its documentation for any purpose is prohibited without the express
+ *              written consent of Arcelik A.S.
+ *  @date       17.10.2026
+ */
+#include "rcos.h"
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/// @brief  Number of posts that can wait in the ring of a group
+#define TEST_RING (4)
+/// @brief  Number of buffers in pool
+#define TEST_BUFFERS (16)
+/// @brief  Posts made while consumer is held, more than the ring takes
+#define TEST_BURST (8)
+/// @brief  Topic records published while consumer is held
+#define TEST_RECORDS (6)
+
+/// @brief  Process enumerations
+typedef enum
+{
+    eTestProducer = 1, ///< Group 0
+    eTestConsumer,     ///< Group 1
+    eTestLimited,      ///< Group 1, quota of a single event
+} teTestProcess;
+
+/// @brief  Events
+typedef enum
+{
+    eTestHold = 1, ///< Consumer waits in its handler until it is released
+    eTestData,     ///< Carries an event buffer with its sequence number
+    eTestTopic,    ///< Topic record
+    eTestPhaseRing,
+    eTestPhaseQuota,
+    eTestPhaseTopic,
+    eTestRelease,
+    eTestCheck,
+} teTestEvent;
+
+CORE_EVENTQUEUE_SIZE(1024)
+CORE_TICK_DEFAULT(0)
+CORE_WDT_DEFAULT(0)
+CORE_EVENTBUF_POOL(TEST_BUFFERS, 8)
+CORE_EXECUTOR_DEFAULT(2, 1024, TEST_RING)
+
+EVENT_QUOTA_CREATE(testQuota, 1, 0, 0, eOverloadDropNew, NULL)
+TOPIC_CREATE(testTopic, eTestTopic, 1)
+
+static uint8_t testHolding;        ///< Consumer waits in its handler, accessed atomically
+static uint8_t testReleased;       ///< Consumer may return, accessed atomically
+static uint32_t testReceived;      ///< Buffers received by consumer and limited process, accessed atomically
+static uint32_t testExpected;      ///< Buffers that must be received, set before posts that may be received
+static uint8_t testSequence;       ///< Sequence number written into next buffer
+static uint8_t testNext;           ///< Sequence number expected by consumer
+static pthread_t testProducerThread;
+static uint8_t testErrors;
+
+/// @brief  Compare a counter or a result with its expected value
+static void testCheck(const char *name, uint32_t value, uint32_t expected)
+{
+    if (value != expected)
+    {
+        printf("%s=%u, expected %u\n", name, value, expected);
+        testErrors++;
+    }
+}
+
+/// @brief  Allocate a buffer that carries next sequence number
+static void *testBuf(void)
+{
+    uint8_t *buf = eventBufAlloc(1);
+
+    if (buf)
+    {
+        buf[0] = testSequence++;
+    }
+
+    return buf;
+}
+
+/// @brief  Post a hold to consumer and wait until its thread is inside the handler
+static void testHold(void)
+{
+    while (__atomic_load_n(&testReceived, __ATOMIC_ACQUIRE) < testExpected)
+    {
+        sched_yield(); // Posts of previous phase are handled and ring is empty
+    }
+    __atomic_store_n(&testReleased, FALSE, __ATOMIC_RELAXED);
+    testCheck("hold posted", EXIT_SUCCESS == eventPost(eTestConsumer, eTestHold, NULL, 0), TRUE);
+    while (FALSE == __atomic_load_n(&testHolding, __ATOMIC_ACQUIRE))
+    {
+        sched_yield();
+    }
+}
+
+/// @brief  Let consumer go on
+static void testRelease(void)
+{
+    __atomic_store_n(&testHolding, FALSE, __ATOMIC_RELAXED);
+    __atomic_store_n(&testReleased, TRUE, __ATOMIC_RELEASE);
+}
+
+static PROCESS_HANDLER_PROTO(testProducerHandler)
+{
+    uint8_t idx;
+
+    testCheck("producer thread", pthread_equal(testProducerThread, pthread_self()), TRUE);
+
+    switch (eventCurrent.event)
+    {
+    case eTestPhaseRing: // Ring takes TEST_RING posts, the others fail and their buffers go back at once
+        testHold();
+        testExpected += TEST_RING;
+        for (idx = 0; idx < TEST_BURST; idx++)
+        {
+            testCheck("ring posted", EXIT_SUCCESS == eventPostRef(eTestConsumer, eTestData, testBuf(), 1), idx < TEST_RING);
+        }
+        testCheck("available while ring is full", POOL_FREE(rcosEventBufPool), TEST_BUFFERS - TEST_RING);
+        testCheck("ring full", rcosExecutor->groups[1].ringFull, TEST_BURST - TEST_RING);
+        testRelease();
+        eventPost(eTestProducer, eTestPhaseQuota, NULL, 0);
+        break;
+
+    case eTestPhaseQuota: // Posts fit into ring, quota drops all but one when consumer thread moves them to queue
+        testHold();
+        testExpected += 1;
+        for (idx = 0; idx < TEST_RING - 1; idx++)
+        {
+            testCheck("quota posted", EXIT_SUCCESS == eventPostRef(eTestLimited, eTestData, testBuf(), 1), TRUE);
+        }
+        testRelease();
+        eventPost(eTestProducer, eTestPhaseTopic, NULL, 0);
+        break;
+
+    case eTestPhaseTopic: // Records are dispatched after this handler, their copies for group 1 fill its ring
+        testHold();
+        testExpected += TEST_RING;
+        for (idx = 0; idx < TEST_RECORDS; idx++)
+        {
+            testCheck("record published", EXIT_SUCCESS == topicPublishRef(&testTopic, testBuf(), 1), TRUE);
+        }
+        eventPost(eTestProducer, eTestRelease, NULL, 0);
+        break;
+
+    case eTestRelease:
+        testCheck("topic ring full", rcosExecutor->groups[1].ringFull, TEST_BURST - TEST_RING + TEST_RECORDS - TEST_RING);
+        testRelease();
+        eventPost(eTestProducer, eTestCheck, NULL, 0);
+        break;
+
+    case eTestCheck:
+        if ((__atomic_load_n(&testReceived, __ATOMIC_ACQUIRE) < testExpected) || (POOL_FREE(rcosEventBufPool) < TEST_BUFFERS))
+        {
+            sched_yield();
+            eventPost(eTestProducer, eTestCheck, NULL, 0); // Consumer thread is not done yet
+            break;
+        }
+        testCheck("received", testReceived, testExpected);
+        testCheck("available at end", POOL_FREE(rcosEventBufPool), TEST_BUFFERS);
+        testCheck("quota dropped", testQuota.drops.dropNew, TEST_RING - 2);
+        printf("executor errors=%u\n", testErrors);
+        exit(testErrors ? EXIT_FAILURE : EXIT_SUCCESS);
+    }
+}
+
+static PROCESS_HANDLER_PROTO(testConsumerHandler)
+{
+    uint8_t sequence;
+
+    testCheck("consumer thread", pthread_equal(testProducerThread, pthread_self()), FALSE);
+
+    if (eTestHold == eventCurrent.event)
+    {
+        __atomic_store_n(&testHolding, TRUE, __ATOMIC_RELEASE);
+        while (FALSE == __atomic_load_n(&testReleased, __ATOMIC_ACQUIRE))
+        {
+            sched_yield();
+        }
+        return;
+    }
+
+    if ((NULL == eventBuf) || (1 != eventBufLength))
+    {
+        testCheck("buffer", FALSE, TRUE);
+        return;
+    }
+
+    sequence = *(uint8_t *)eventBuf;
+    if (eTestConsumer == process->enumeration)
+    {
+        if ((int8_t)(sequence - testNext) < 0)
+        {
+            printf("sequence %u after %u\n", sequence, testNext);
+            testErrors++;
+        }
+        testNext = (uint8_t)(sequence + 1);
+    }
+    __atomic_add_fetch(&testReceived, 1, __ATOMIC_RELEASE);
+}
+
+static PROCESS_INIT_PROTO(testInit)
+{
+    if (eTestProducer == process->enumeration)
+    {
+        process->handlerCurrent = testProducerHandler;
+        return;
+    }
+
+    process->handlerCurrent = testConsumerHandler;
+    if (eTestLimited == process->enumeration)
+    {
+        process->quota = &testQuota;
+    }
+    else
+    {
+        topicSubscribe(&testTopic, process->enumeration);
+    }
+}
+
+static PROCESS_DEINIT_PROTO(testDeinit)
+{
+}
+
+PROCESS_CREATE(testProducer, testInit, testDeinit, eTestProducer, NULL, NULL)
+PROCESS_CREATE(testConsumer, testInit, testDeinit, eTestConsumer, NULL, NULL)
+PROCESS_CREATE(testLimited, testInit, testDeinit, eTestLimited, NULL, NULL)
+
+int main(void)
+{
+    testProducerThread = pthread_self();
+
+    platformInit();
+    coreInit();
+    testCheck("affinity", EXIT_SUCCESS == processAffinity(&testConsumer, 1), TRUE);
+    testCheck("affinity", EXIT_SUCCESS == processAffinity(&testLimited, 1), TRUE);
+    testCheck("affinity of missing group", EXIT_SUCCESS == processAffinity(&testProducer, 2), FALSE);
+    processStart(&testProducer);
+    processStart(&testConsumer);
+    processStart(&testLimited);
+
+    eventPost(eTestProducer, eTestPhaseRing, NULL, 0);
+
+    coreRun();
+}
@@ -0,0 +1,123 @@
+/** @file       test_isr_ring.c
+ *  @brief      Checks that the isr ingress ring delivers every event of concurrent producers once, with its data
+ *              and in the order each producer posted them
+ *  @copyright  (c) 2026-Arcelik - All Rights Reserved
+ *              Permission to use, reproduce, copy, prepare derivative works,
+ *              modify, distribute, perform, display or sell this software and/or
+ *              its documentation for any purpose is prohibited without the express
+ *              written consent of Arcelik A.S.
+ *  @date       17.10.2026
+ */
+#include "rcos.h"
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/// @brief  Number of producer threads, each posts with its own event enumeration
+#define TEST_PRODUCERS (4)
+/// @brief  Number of events posted by each producer
+#define TEST_POSTS (50000ul)
+/// @brief  Events of a producer that may wait in ring or queue, like an isr that fires faster than it is handled
+#define TEST_WINDOW (32)
+/// @brief  Enumeration of consumer process
+#define TEST_CONSUMER (1)
+
+CORE_EVENTQUEUE_SIZE(8192)
+CORE_TICK_DEFAULT(0)
+CORE_WDT_DEFAULT(0)
+
+static uint32_t testNext[TEST_PRODUCERS]; ///< Sequence number expected from each producer
+static uint32_t testReceived;
+static uint32_t testErrors;
+static uint32_t testRingFull;             ///< Posts retried because ring was full, accessed atomically
+
+/// @brief  Interrupt exit of producers, wakes coreRun up when it sleeps
+static void testIsrExit(void)
+{
+}
+
+/** @brief  Producer thread, posts a sequence number and its complement so torn slots are detected
+ *  @details Posts are made without taking the interrupt lock, like nested isrs of different priorities, so producers
+ *           race for ring slots.
+ */
+static void *testProducer(void *arg)
+{
+    uint8_t producer = (uint8_t)(uintptr_t)arg;
+    uint32_t data[2];
+    uint32_t sequence;
+
+    for (sequence = 0; sequence < TEST_POSTS; sequence++)
+    {
+        data[0] = sequence;
+        data[1] = ~sequence;
+        while ((sequence - __atomic_load_n(&testNext[producer], __ATOMIC_ACQUIRE)) >= TEST_WINDOW)
+        {
+            sched_yield();
+        }
+        while (EXIT_SUCCESS != eventPostFromIsr(TEST_CONSUMER, producer, data, sizeof(data)))
+        {
+            __atomic_add_fetch(&testRingFull, 1, __ATOMIC_RELAXED);
+            sched_yield();
+        }
+        hostIsrRun(testIsrExit);
+    }
+
+    return NULL;
+}
+
+static PROCESS_HANDLER_PROTO(testConsumerHandler)
+{
+    uint32_t data[2];
+
+    if ((eventCurrent.event >= TEST_PRODUCERS) || (sizeof(data) != eventCurrent.length))
+    {
+        printf("unexpected event %u length %u\n", eventCurrent.event, eventCurrent.length);
+        exit(EXIT_FAILURE);
+    }
+
+    memcpy(data, eventData, sizeof(data));
+    if ((data[0] != testNext[eventCurrent.event]) || (data[1] != ~data[0]))
+    {
+        if (testErrors++ < 10)
+        {
+            printf("producer %u sent %u/%08x, expected %u\n", eventCurrent.event, data[0], data[1], testNext[eventCurrent.event]);
+        }
+    }
+    __atomic_store_n(&testNext[eventCurrent.event], data[0] + 1, __ATOMIC_RELEASE);
+
+    if (++testReceived == (TEST_PRODUCERS * TEST_POSTS))
+    {
+        printf("isr ring received=%u errors=%u full=%u\n", testReceived, testErrors, __atomic_load_n(&testRingFull, __ATOMIC_RELAXED));
+        exit(testErrors ? EXIT_FAILURE : EXIT_SUCCESS);
+    }
+}
+
+static PROCESS_INIT_PROTO(testConsumerInit)
+{
+    process->handlerCurrent = testConsumerHandler;
+}
+
+static PROCESS_DEINIT_PROTO(testConsumerDeinit)
+{
+}
+
+PROCESS_CREATE(testConsumer, testConsumerInit, testConsumerDeinit, TEST_CONSUMER, NULL, NULL)
+
+int main(void)
+{
+    pthread_t threads[TEST_PRODUCERS];
+    uint8_t idx;
+
+    platformInit();
+    coreInit();
+    processStart(&testConsumer);
+
+    for (idx = 0; idx < TEST_PRODUCERS; idx++)
+    {
+        pthread_create(&threads[idx], NULL, testProducer, (void *)(uintptr_t)idx);
+    }
+
+    coreRun();
+}
@@ -0,0 +1,104 @@
+/** @file       test_priority.c
+ *  @brief      Checks that events of higher priority queues are always dispatched first and that queues of the same
+ *              priority are served round-robin, CORE_EVENTQUEUE_BURST events at a time
+ *  @copyright  (c) 2026-Arcelik - All Rights Reserved
+ *              Permission to use, reproduce, copy, prepare derivative works,
+ *              modify, distribute, perform, display or sell this software and/or
+ *              its documentation for any purpose is prohibited without the express
+ *              written consent of Arcelik A.S.
+ *  @date       17.10.2026
+ */
+#include "rcos.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/// @brief  Handled events expected as process:event, d marks an event with data
+#if 1 == CORE_EVENTQUEUE_BURST
+#define TEST_EXPECTED "4:1 4:2d 2:1 3:1 2:2d 3:2 2:3 1:1 4:9 2:9 1:2d 1:3 "
+#else
+#error "Expected order is written for a burst of 1"
+#endif
+
+/// @brief  Process enumerations
+typedef enum
+{
+    eTestShared = 1, ///< Default priority, shared queue
+    eTestMidA,       ///< Priority 1, own queue
+    eTestMidB,       ///< Priority 1, own queue
+    eTestHigh,       ///< Priority 3, own queue
+} teTestProcess;
+
+static void testEnd(void);
+
+CORE_EVENTQUEUE_SIZE(256)
+CORE_TICK_CREATE_SIMULATION(100, testEnd)
+CORE_WDT_DEFAULT(0)
+
+static char testLog[128];
+static uint8_t testLogLength;
+
+static PROCESS_HANDLER_PROTO(testHandler)
+{
+    testLogLength += (uint8_t)snprintf(&testLog[testLogLength], sizeof(testLog) - testLogLength, "%u:%u%s ",
+                                       process->enumeration, eventCurrent.event, eventCurrent.length ? "d" : "");
+
+    if ((eTestShared == process->enumeration) && (1 == eventCurrent.event))
+    {
+        eventPost(eTestMidA, 9, NULL, 0); // Both are dispatched before the next event of shared queue
+        eventPost(eTestHigh, 9, NULL, 0);
+    }
+}
+
+static PROCESS_INIT_PROTO(testInit)
+{
+    process->handlerCurrent = testHandler;
+}
+
+static PROCESS_DEINIT_PROTO(testDeinit)
+{
+}
+
+PROCESS_CREATE(testShared, testInit, testDeinit, eTestShared, NULL, NULL)
+PROCESS_CREATE_PRIORITY(testMidA, testInit, testDeinit, eTestMidA, NULL, NULL, 1, 64)
+PROCESS_CREATE_PRIORITY(testMidB, testInit, testDeinit, eTestMidB, NULL, NULL, 1, 64)
+PROCESS_CREATE_PRIORITY(testHigh, testInit, testDeinit, eTestHigh, NULL, NULL, 3, 64)
+
+/// @brief  Simulation ends when every event is handled
+static void testEnd(void)
+{
+    if (strcmp(testLog, TEST_EXPECTED))
+    {
+        printf("handled \"%s\", expected \"%s\"\n", testLog, TEST_EXPECTED);
+        exit(EXIT_FAILURE);
+    }
+
+    printf("priority order ok\n");
+    exit(EXIT_SUCCESS);
+}
+
+int main(void)
+{
+    uint8_t data = 0x5a;
+
+    platformInit();
+    coreInit();
+    processStart(&testShared);
+    processStart(&testMidA);
+    processStart(&testMidB);
+    processStart(&testHigh);
+
+    // Posted from lowest to highest priority, dispatch order must not depend on it
+    eventPost(eTestShared, 1, NULL, 0);
+    eventPost(eTestShared, 2, &data, 1);
+    eventPost(eTestShared, 3, NULL, 0);
+    eventPost(eTestMidA, 1, NULL, 0);
+    eventPost(eTestMidA, 2, &data, 1);
+    eventPost(eTestMidA, 3, NULL, 0);
+    eventPost(eTestMidB, 1, NULL, 0);
+    eventPost(eTestMidB, 2, NULL, 0);
+    eventPost(eTestHigh, 1, NULL, 0);
+    eventPost(eTestHigh, 2, &data, 1);
+
+    coreRun();
+}
@@ -0,0 +1,154 @@
+/** @file       test_quota.c
+ *  @brief      Checks every overload policy of event quotas, their drop counters and congestion watermarks
+ *  @copyright  (c) 2026-Arcelik - All Rights Reserved
+ *              Permission to use, reproduce, copy, prepare derivative works,
+ *              modify, distribute, perform, display or sell this software and/or
+ *              its documentation for any purpose is prohibited without the express
+ *              written consent of Arcelik A.S.
+ *  @date       17.10.2026
+ */
+#include "rcos.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/// @brief  Handled events expected as process:event, d marks an event with data and c a congested destination
+#define TEST_EXPECTED "1:1 1:2 2:3 2:4 2:5 3:1 4:1c 4:2c 4:3c 4:4 5:7 5:8d "
+
+/// @brief  Process enumerations, one for each quota
+typedef enum
+{
+    eTestDropNew = 1,
+    eTestDropOldest,
+    eTestReject,
+    eTestCongestion,
+    eTestCoalesce,
+} teTestProcess;
+
+static void testEnd(void);
+static void testReject(tProcessEnum destination, tEventEnum event);
+
+CORE_EVENTQUEUE_SIZE(512)
+CORE_TICK_CREATE_SIMULATION(1000, testEnd)
+CORE_WDT_DEFAULT(0)
+
+EVENT_QUOTA_CREATE(testQuotaDropNew, 2, 0, 0, eOverloadDropNew, NULL)
+EVENT_QUOTA_CREATE(testQuotaDropOldest, 3, 0, 0, eOverloadDropOldest, NULL)
+EVENT_QUOTA_CREATE(testQuotaReject, 1, 0, 0, eOverloadReject, testReject)
+EVENT_QUOTA_CREATE(testQuotaCongestion, 0, 3, 1, eOverloadDropNew, NULL)
+EVENT_QUOTA_CREATE(testQuotaCoalesce, 2, 0, 0, eOverloadCoalesce, NULL)
+TIMER_EVENT_CREATE(testTimer, eTestDropNew, eTestDropNew, 9)
+
+static char testLog[128];
+static uint8_t testLogLength;
+static uint8_t testRejects;
+static uint8_t testErrors;
+
+static void testReject(tProcessEnum destination, tEventEnum event)
+{
+    if (eTestReject == destination)
+    {
+        testRejects++;
+    }
+}
+
+static PROCESS_HANDLER_PROTO(testHandler)
+{
+    testLogLength += (uint8_t)snprintf(&testLog[testLogLength], sizeof(testLog) - testLogLength, "%u:%u%s%s ",
+                                       process->enumeration, eventCurrent.event, eventCurrent.length ? "d" : "",
+                                       eventCongested(process->enumeration) ? "c" : "");
+}
+
+static PROCESS_INIT_PROTO(testInit)
+{
+    static tsEventQuota *const quotas[] = {&testQuotaDropNew, &testQuotaDropOldest, &testQuotaReject,
+                                           &testQuotaCongestion, &testQuotaCoalesce};
+
+    process->handlerCurrent = testHandler;
+    process->quota          = quotas[process->enumeration - eTestDropNew];
+}
+
+static PROCESS_DEINIT_PROTO(testDeinit)
+{
+}
+
+PROCESS_CREATE(testDropNew, testInit, testDeinit, eTestDropNew, NULL, NULL)
+PROCESS_CREATE(testDropOldest, testInit, testDeinit, eTestDropOldest, NULL, NULL)
+PROCESS_CREATE(testRejected, testInit, testDeinit, eTestReject, NULL, NULL)
+PROCESS_CREATE(testCongestion, testInit, testDeinit, eTestCongestion, NULL, NULL)
+PROCESS_CREATE(testCoalesce, testInit, testDeinit, eTestCoalesce, NULL, NULL)
+
+/// @brief  Compare a counter or a result with its expected value
+static void testCheck(const char *name, uint32_t value, uint32_t expected)
+{
+    if (value != expected)
+    {
+        printf("%s=%u, expected %u\n", name, value, expected);
+        testErrors++;
+    }
+}
+
+/// @brief  Simulation ends when every event is handled
+static void testEnd(void)
+{
+    if (strcmp(testLog, TEST_EXPECTED))
+    {
+        printf("handled \"%s\", expected \"%s\"\n", testLog, TEST_EXPECTED);
+        testErrors++;
+    }
+    testCheck("dropNew", testQuotaDropNew.drops.dropNew, 3); // Expired timer is dropped once, it is not retried
+    testCheck("dropOldest", testQuotaDropOldest.drops.dropOldest, 2);
+    testCheck("rejected", testQuotaReject.drops.rejected, 2);
+    testCheck("reject calls", testRejects, 2);
+    testCheck("congested", eventCongested(eTestCongestion), FALSE);
+    testCheck("coalesced", testQuotaCoalesce.drops.coalesced, 1);
+    testCheck("coalesce dropNew", testQuotaCoalesce.drops.dropNew, 1);
+    testCheck("all dropped", eventDrops.dropNew + eventDrops.dropOldest + eventDrops.rejected + eventDrops.coalesced, 9);
+
+    printf("quota errors=%u\n", testErrors);
+    exit(testErrors ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+
+int main(void)
+{
+    uint8_t data = 0x5a;
+    tEventEnum event;
+    uint8_t tick;
+
+    platformInit();
+    coreInit();
+    processStart(&testDropNew);
+    processStart(&testDropOldest);
+    processStart(&testRejected);
+    processStart(&testCongestion);
+    processStart(&testCoalesce);
+
+    for (event = 1; event <= 4; event++)
+    {
+        testCheck("dropNew posted", EXIT_SUCCESS == eventPost(eTestDropNew, event, NULL, 0), event <= 2);
+    }
+    timerEventStart(&testTimer, 1); // Expires while quota is full, it must not be posted again on every tick
+    for (tick = 0; tick < 5; tick++)
+    {
+        hostIsrRun(rcosTickIsr);
+    }
+    for (event = 1; event <= 5; event++)
+    {
+        testCheck("dropOldest posted", EXIT_SUCCESS == eventPost(eTestDropOldest, event, NULL, 0), TRUE);
+    }
+    for (event = 1; event <= 3; event++)
+    {
+        testCheck("reject posted", EXIT_SUCCESS == eventPost(eTestReject, event, NULL, 0), 1 == event);
+    }
+    for (event = 1; event <= 4; event++)
+    {
+        eventPost(eTestCongestion, event, NULL, 0);
+        testCheck("congested after post", eventCongested(eTestCongestion), (event >= 3) ? TRUE : FALSE);
+    }
+    testCheck("coalesce posted", EXIT_SUCCESS == eventPost(eTestCoalesce, 7, NULL, 0), TRUE);
+    testCheck("coalesce posted", EXIT_SUCCESS == eventPost(eTestCoalesce, 8, &data, 1), TRUE);
+    testCheck("coalesce posted", EXIT_SUCCESS == eventPost(eTestCoalesce, 7, NULL, 0), TRUE);  // Merged into waiting 7
+    testCheck("coalesce posted", EXIT_SUCCESS == eventPost(eTestCoalesce, 9, NULL, 0), FALSE); // Nothing to merge into
+
+    coreRun();
+}
@@ -0,0 +1,210 @@
+/** @file       test_record_replay.c
+ *  @brief      Checks that replay feeds handlers the same isr posts, received data and I/O values at the same ticks
+ *              as the recorded run, while live inputs of the replayed run are different
+ *  @details    A child process records into a memory file and passes the hash of everything its handlers saw through
+ *              a pipe, parent replays the file in virtual time and compares its own hash.
+ *  @copyright  (c) 2026-Arcelik - All Rights Reserved
+ *              Permission to use, reproduce, copy, prepare derivative works,
+ *              modify, distribute, perform, display or sell this software and/or
+ *              its documentation for any purpose is prohibited without the express
+ *              written consent of Arcelik A.S.
+ *  @date       17.10.2026
+ */
+#include "rcos.h"
+#include "dev/host/memfile.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+/// @brief  Enumeration of observing process
+#define TEST_PROCESS (1)
+/// @brief  Event of periodic poll
+#define TEST_EVENT_POLL (1)
+/// @brief  Event posted by isr
+#define TEST_EVENT_ISR (2)
+/// @brief  Size of record storage
+#define TEST_STORE_SIZE (65536ul)
+
+static void testEnd(void);
+
+CORE_EVENTQUEUE_SIZE(256)
+CORE_TICK_CREATE_SIMULATION(2000, testEnd)
+CORE_WDT_DEFAULT(0)
+CORE_RECORDER_CREATE(512, 2)
+DEV_MEM_MEMFILE_CREATE(testStore, "test_record_replay.bin", TEST_STORE_SIZE)
+
+/// @brief  Result of a run
+typedef struct
+{
+    uint32_t hash;         ///< Hash of every input seen by handlers with its tick
+    uint32_t observations; ///< Number of inputs seen
+    uint32_t lost;         ///< Records lost
+} tsTestResult;
+
+static teBool testReplay;
+static tsTestResult testResult = {5381, 0, 0};
+static int testPipe[2];
+
+static void testMix(uint32_t value)
+{
+    testResult.hash = (testResult.hash * 33) ^ value;
+    testResult.observations++;
+}
+
+/// @brief  Live value changes every 100 ticks while recording, it is constant while replaying
+static DEV_IO_FUNC_GET(testIoGet)
+{
+    return testReplay ? 999 : (rcosTickCount() / 100);
+}
+
+/// @brief  Live data arrives every 30 ticks while recording, replay receives a different stream
+static DEV_COM_FUNC_RECEIVE(testComReceive)
+{
+    static uint32_t last = UINT32_MAX;
+    uint8_t *bytes = (uint8_t *)rxb;
+    uint16_t idx;
+
+    if ((0 == length) || (last == rcosTickCount()) || (rcosTickCount() % (testReplay ? 7 : 30)))
+    {
+        return 0;
+    }
+
+    last = rcosTickCount();
+    for (idx = 0; idx < MIN(length, 3); idx++)
+    {
+        bytes[idx] = testReplay ? 'X' : (uint8_t)('a' + (rcosTickCount() / 30 + idx) % 26);
+    }
+
+    return idx;
+}
+
+static const tsDevIoFuncs testIoFuncs   = {NULL, NULL, testIoGet, NULL};
+static const tsDevComFuncs testComFuncs = {NULL, NULL, NULL, NULL, NULL, testComReceive, NULL, NULL};
+DEV_IO_CREATE(testIo, testIoFuncs, NULL, NULL)
+DEV_COM_CREATE(testCom, testComFuncs, NULL, NULL)
+
+/// @brief  Interrupt source with a different period and data while replaying
+static TIMER_CALLBACK_FUNC(testIsr)
+{
+    uint8_t data[2] = {(uint8_t)rcosTickCount(), testReplay ? 7 : 1};
+
+    eventPostFromIsr(TEST_PROCESS, TEST_EVENT_ISR, data, sizeof(data));
+
+    return testReplay ? 13 : 17;
+}
+
+TIMER_CALLBACK_CREATE(testIsrTimer, testIsr, NULL)
+TIMER_EVENT_CREATE(testPoll, TEST_PROCESS, TEST_PROCESS, TEST_EVENT_POLL)
+
+static PROCESS_HANDLER_PROTO(testHandler)
+{
+    uint8_t bytes[2];
+    uint16_t count;
+    uint16_t idx;
+
+    if (TEST_EVENT_POLL == eventCurrent.event)
+    {
+        while ((count = devComReceive(&testCom, bytes, sizeof(bytes))))
+        {
+            for (idx = 0; idx < count; idx++)
+            {
+                testMix(bytes[idx] ^ (rcosTickCount() << 8));
+            }
+        }
+        testMix(devIoGet(&testIo) + rcosTickCount() * 1000);
+        timerEventStart(&testPoll, 10);
+        recordDrain();
+    }
+    else if (TEST_EVENT_ISR == eventCurrent.event)
+    {
+        testMix(((uint8_t *)eventData)[0] | (((uint8_t *)eventData)[1] << 8) | (rcosTickCount() << 16));
+    }
+}
+
+static PROCESS_INIT_PROTO(testInit)
+{
+    process->handlerCurrent = testHandler;
+}
+
+static PROCESS_DEINIT_PROTO(testDeinit)
+{
+}
+
+PROCESS_CREATE(testProcess, testInit, testDeinit, TEST_PROCESS, NULL, NULL)
+
+/// @brief  Simulation ends, recording run reports its result to parent, replay run compares
+static void testEnd(void)
+{
+    tsTestResult recorded;
+
+    recordDrain();
+    testResult.lost = rcosRecorder->lost;
+
+    if (FALSE == testReplay)
+    {
+        exit((sizeof(testResult) == write(testPipe[1], &testResult, sizeof(testResult))) ? EXIT_SUCCESS : EXIT_FAILURE);
+    }
+
+    if (sizeof(recorded) != read(testPipe[0], &recorded, sizeof(recorded)))
+    {
+        printf("recording run did not report\n");
+        exit(EXIT_FAILURE);
+    }
+
+    printf("record hash=%08x observations=%u lost=%u\n", recorded.hash, recorded.observations, recorded.lost);
+    printf("replay hash=%08x observations=%u lost=%u\n", testResult.hash, testResult.observations, testResult.lost);
+
+    exit(((recorded.hash == testResult.hash) && (recorded.observations == testResult.observations) &&
+          (0 == recorded.lost) && (recorded.observations > 100)) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+/// @brief  Initialize system and start recording or replay
+static void testRun(void)
+{
+    platformInit();
+    coreInit();
+    devMemInit(&testStore);
+    recordDevice(&testIo);
+    recordDevice(&testCom);
+
+    if (TRUE == testReplay)
+    {
+        replayStart(&testStore, 0, TEST_STORE_SIZE);
+    }
+    else
+    {
+        devMemErase(&testStore, 0, TEST_STORE_SIZE);
+        recordStart(&testStore, 0, TEST_STORE_SIZE);
+    }
+
+    processStart(&testProcess);
+    timerEventStart(&testPoll, 10);
+    timerCallBackStart(&testIsrTimer, 17);
+    coreRun();
+}
+
+int main(void)
+{
+    int status;
+    pid_t child;
+
+    if (pipe(testPipe))
+    {
+        return EXIT_FAILURE;
+    }
+
+    child = fork(); // Before platformInit, recording run starts its own platform threads
+    if (0 == child)
+    {
+        testRun();
+    }
+    if ((child < 0) || (child != waitpid(child, &status, 0)) || (0 == WIFEXITED(status)) || WEXITSTATUS(status))
+    {
+        printf("recording run failed\n");
+        return EXIT_FAILURE;
+    }
+
+    testReplay = TRUE;
+    testRun();
+}
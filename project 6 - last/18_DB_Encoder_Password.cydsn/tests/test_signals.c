@@ -0,0 +1,225 @@
+/** @file       test_signals.c
+ *  @brief      Checks that events without data waiting in the signal ring and events with data waiting in the byte
+ *              queue are dispatched in the order they were posted, front posts first, when the ring is full, when
+ *              drop-oldest leaves removed signals in it and when ring positions wrap around
+ *  @copyright  (c) 2026-Arcelik - All Rights Reserved
+ *              Permission to use, reproduce, copy, prepare derivative works,
+ *              modify, distribute, perform, display or sell this software and/or
+ *              its documentation for any purpose is prohibited without the express
+ *              written consent of Arcelik A.S.
+ *  @date       17.10.2026
+ */
+#include "rcos.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/// @brief  Handled events expected as process:event, d marks an event with data
+#if 16 == CORE_EVENTQUEUE_SIGNALS
+#define TEST_EXPECTED "1:5 1:4 1:1 1:2d 1:3 "                                                            \
+                      "1:6 2:3 2:4d "                                                                    \
+                      "1:9 1:10 1:11 1:12 1:13 1:14 1:15 1:16 1:17 1:18 1:19 1:20 1:21 1:22 1:23 1:24 " \
+                      "1:25 1:26d 1:27 "
+#else
+#error "Expected order is written for a signal ring of 16"
+#endif
+/// @brief  Rounds of chain, each one moves ring positions by 2 and wraps them around a few times
+#define TEST_ROUNDS (300)
+
+/// @brief  Process enumerations
+typedef enum
+{
+    eTestSink = 1, ///< Handles every event
+    eTestOldest,   ///< Quota of two events that drops old events
+} teTestProcess;
+
+/// @brief  Events that start a phase or form the chain, they are not logged
+typedef enum
+{
+    eTestMix = 200,  ///< Signals and data posted to back and front
+    eTestTombstone,  ///< Drop-oldest removes signals that wait in ring
+    eTestRingFull,   ///< Signals that do not fit into ring go to byte queue
+    eTestChain,      ///< Starts a round of chain
+    eTestChainFront, ///< Posted to front in a round
+    eTestChainSignal,
+    eTestChainData,
+} teTestEvent;
+
+static void testEnd(void);
+
+CORE_EVENTQUEUE_SIZE(256)
+CORE_TICK_CREATE_SIMULATION(100, testEnd)
+CORE_WDT_DEFAULT(0)
+
+EVENT_QUOTA_CREATE(testQuota, 2, 0, 0, eOverloadDropOldest, NULL)
+
+static char testLog[192];
+static uint8_t testLogLength;
+static uint8_t testErrors;
+static uint16_t testRound;
+static tEventEnum testChainNext = eTestChain;
+static tEventEnum testIsrEvents[2];
+
+/// @brief  Compare a counter or a result with its expected value
+static void testCheck(const char *name, uint32_t value, uint32_t expected)
+{
+    if (value != expected)
+    {
+        printf("%s=%u, expected %u\n", name, value, expected);
+        testErrors++;
+    }
+}
+
+/// @brief  Post events of testIsrEvents to front of queue, the last one is dispatched first
+static void testIsrFront(void)
+{
+    uint8_t idx;
+
+    for (idx = 0; (idx < sizeof(testIsrEvents) / sizeof(testIsrEvents[0])) && testIsrEvents[idx]; idx++)
+    {
+        testCheck("front posted", EXIT_SUCCESS == eventPostInIsr(eTestSink, testIsrEvents[idx]), TRUE);
+    }
+}
+
+/// @brief  Post events to front of queue from an isr
+static void testFront(tEventEnum first, tEventEnum second)
+{
+    testIsrEvents[0] = first;
+    testIsrEvents[1] = second;
+    hostIsrRun(testIsrFront);
+}
+
+/// @brief  Every round posts a signal, an event with data and next round to back and a signal to front
+static void testChain(void)
+{
+    uint8_t data;
+
+    switch (eventCurrent.event)
+    {
+    case eTestChain:
+        if (TEST_ROUNDS == testRound)
+        {
+            return;
+        }
+        data = (uint8_t)testRound;
+        eventPost(eTestSink, eTestChainSignal, NULL, 0);
+        eventPost(eTestSink, eTestChainData, &data, sizeof(data));
+        eventPost(eTestSink, eTestChain, NULL, 0);
+        testFront(eTestChainFront, EVENT_NONE);
+        testChainNext = eTestChainFront;
+        break;
+
+    case eTestChainFront:
+        testChainNext = eTestChainSignal;
+        break;
+
+    case eTestChainSignal:
+        testChainNext = eTestChainData;
+        break;
+
+    case eTestChainData:
+        testCheck("chain data", eventData[0], (uint8_t)testRound);
+        testRound++;
+        testChainNext = eTestChain;
+        break;
+    }
+}
+
+static PROCESS_HANDLER_PROTO(testHandler)
+{
+    uint8_t data = 0x5a;
+    tEventEnum event;
+
+    if (eventCurrent.event >= eTestChain)
+    {
+        if (eventCurrent.event != testChainNext)
+        {
+            printf("chain event %u in round %u, expected %u\n", eventCurrent.event, testRound, testChainNext);
+            testErrors++;
+        }
+        testChain();
+        return;
+    }
+
+    if (eventCurrent.event < eTestMix)
+    {
+        testLogLength += (uint8_t)snprintf(&testLog[testLogLength], sizeof(testLog) - testLogLength, "%u:%u%s ",
+                                           process->enumeration, eventCurrent.event, eventCurrent.length ? "d" : "");
+        return;
+    }
+
+    switch (eventCurrent.event)
+    {
+    case eTestMix: // Front posts are dispatched before every waiting event, the last one first
+        eventPost(eTestSink, 1, NULL, 0);
+        eventPost(eTestSink, 2, &data, sizeof(data));
+        eventPost(eTestSink, 3, NULL, 0);
+        testFront(4, 5);
+        eventPost(eTestSink, eTestTombstone, NULL, 0);
+        break;
+
+    case eTestTombstone: // 2:1 and 2:2 are removed where they wait, in front of 1:6
+        eventPost(eTestOldest, 1, NULL, 0);
+        eventPost(eTestOldest, 2, NULL, 0);
+        eventPost(eTestSink, 6, NULL, 0);
+        eventPost(eTestOldest, 3, NULL, 0);
+        eventPost(eTestOldest, 4, &data, sizeof(data));
+        eventPost(eTestSink, eTestRingFull, NULL, 0);
+        break;
+
+    case eTestRingFull: // 10..25 fill ring, 26 and 27 wait behind them in byte queue, front post 9 goes there too
+        for (event = 10; event < 10 + CORE_EVENTQUEUE_SIGNALS; event++)
+        {
+            eventPost(eTestSink, event, NULL, 0);
+        }
+        eventPost(eTestSink, 26, &data, sizeof(data));
+        eventPost(eTestSink, 27, NULL, 0);
+        testFront(9, EVENT_NONE);
+        eventPost(eTestSink, eTestChain, NULL, 0);
+        break;
+    }
+}
+
+static PROCESS_INIT_PROTO(testInit)
+{
+    process->handlerCurrent = testHandler;
+    if (eTestOldest == process->enumeration)
+    {
+        process->quota = &testQuota;
+    }
+}
+
+static PROCESS_DEINIT_PROTO(testDeinit)
+{
+}
+
+PROCESS_CREATE(testSink, testInit, testDeinit, eTestSink, NULL, NULL)
+PROCESS_CREATE(testOldest, testInit, testDeinit, eTestOldest, NULL, NULL)
+
+/// @brief  Simulation ends when every event is handled
+static void testEnd(void)
+{
+    if (strcmp(testLog, TEST_EXPECTED))
+    {
+        printf("handled \"%s\", expected \"%s\"\n", testLog, TEST_EXPECTED);
+        testErrors++;
+    }
+    testCheck("chain rounds", testRound, TEST_ROUNDS);
+    testCheck("dropOldest", testQuota.drops.dropOldest, 2);
+    testCheck("signal max", eventQueue.signalMax, CORE_EVENTQUEUE_SIGNALS);
+
+    printf("signals errors=%u\n", testErrors);
+    exit(testErrors ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+
+int main(void)
+{
+    platformInit();
+    coreInit();
+    processStart(&testSink);
+    processStart(&testOldest);
+
+    eventPost(eTestSink, eTestMix, NULL, 0);
+
+    coreRun();
+}
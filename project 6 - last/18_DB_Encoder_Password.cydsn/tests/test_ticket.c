@@ -0,0 +1,185 @@
+/** @file       test_ticket.c
+ *  @brief      Checks that waiting tickets of a ticket vending machine with a queue are up by class and then by age,
+ *              that aging moves a starving ticket up, that tickets beyond the queue are up in order after it and that
+ *              a ticket taken in an isr is not posted to the process that the isr interrupted
+ *  @copyright  (c) 2026-Arcelik - All Rights Reserved
+ *              Permission to use, reproduce, copy, prepare derivative works,
+ *              modify, distribute, perform, display or sell this software and/or
+ *              its documentation for any purpose is prohibited without the express
+ *              written consent of Arcelik A.S.
+ *  @date       17.10.2026
+ */
+#include "rcos.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/// @brief  Tickets expected in the order they are up, by their labels
+#define TEST_EXPECTED "h u i n b o h b u n "
+/// @brief  Enumeration of process under test
+#define TEST_PROCESS (1)
+/// @brief  Wait time in ticks that moves a ticket one class up
+#define TEST_AGING (20)
+/// @brief  Number of waiters in queue
+#define TEST_WAITERS (4)
+
+/// @brief  Events
+typedef enum
+{
+    eTestClasses = 1, ///< Tickets of each class, one from an isr and one beyond queue
+    eTestAging,       ///< A bulk ticket waits long enough to be up before an urgent one
+    eTestLate,        ///< Urgent and normal tickets of aging phase
+    eTestRelease,     ///< Holder of first ticket is done
+    eTestUp,          ///< A ticket is up, tTicket is data
+} teTestEvent;
+
+static void testEnd(void);
+
+CORE_EVENTQUEUE_SIZE(256)
+CORE_TICK_CREATE_SIMULATION(1000, testEnd)
+CORE_WDT_DEFAULT(0)
+
+TVM_QUEUE_CREATE(testQueue, TEST_WAITERS, TEST_AGING)
+static tsTvm testTvm = TVM_INIT();
+
+TIMER_EVENT_CREATE(testReleaseTimer, TEST_PROCESS, TEST_PROCESS, eTestRelease)
+TIMER_EVENT_CREATE(testLateTimer, TEST_PROCESS, TEST_PROCESS, eTestLate)
+
+static char testLabels[16];     ///< Label of each ticket
+static char testLog[64];
+static uint8_t testLogLength;
+static uint8_t testErrors;
+static tTicket testIsrTicket;   ///< Ticket taken in isr, its holder checks it with TICKET_IS_UP
+static tTicket testOverflow;    ///< Ticket that did not fit into queue, up without a post
+static teBool testAgingStarted; ///< Isr and overflow tickets are done
+
+/// @brief  Compare a counter or a result with its expected value
+static void testCheck(const char *name, uint32_t value, uint32_t expected)
+{
+    if (value != expected)
+    {
+        printf("%s=%u, expected %u\n", name, value, expected);
+        testErrors++;
+    }
+}
+
+/// @brief  Take a ticket of a class and label it
+static tTicket testGet(uint8_t prio, uint8_t event, char label)
+{
+    tTicket ticket = tvmGet(&testTvm, prio, event);
+
+    testLabels[ticket % sizeof(testLabels)] = label;
+
+    return ticket;
+}
+
+/// @brief  Log the ticket that is up and give the resource to the next one
+static void testDone(tTicket ticket)
+{
+    testCheck("up", TICKET_IS_UP(testTvm, ticket), TRUE);
+    testLogLength += (uint8_t)snprintf(&testLog[testLogLength], sizeof(testLog) - testLogLength, "%c ",
+                                       testLabels[ticket % sizeof(testLabels)]);
+    TICKET_REMOVE(testTvm);
+}
+
+/// @brief  Runs inside the handler of the process, eventCurrent still belongs to it
+static void testIsr(void)
+{
+    testIsrTicket = testGet(eTicketUrgent, eTestUp, 'i');
+}
+
+static PROCESS_HANDLER_PROTO(testHandler)
+{
+    tTicket ticket;
+
+    switch (eventCurrent.event)
+    {
+    case eTestClasses: // Holder keeps its ticket for 10 ticks, less than aging, so classes decide
+        testGet(eTicketNormal, EVENT_NONE, 'h'); // Up at once, nobody holds the resource
+        testGet(eTicketBulk, eTestUp, 'b');
+        testGet(eTicketNormal, eTestUp, 'n');
+        testGet(eTicketUrgent, eTestUp, 'u');
+        hostIsrRun(testIsr);
+        testOverflow = testGet(eTicketNormal, EVENT_NONE, 'o');
+        testCheck("overflow count", testQueue.overflowCount, 1);
+        timerEventStart(&testReleaseTimer, 10);
+        break;
+
+    case eTestAging: // Bulk ticket waits 50 ticks, it is up before an urgent ticket that waits 5
+        testAgingStarted = TRUE;
+        testGet(eTicketNormal, EVENT_NONE, 'h');
+        testGet(eTicketBulk, eTestUp, 'b');
+        timerEventStart(&testLateTimer, 45);
+        timerEventStart(&testReleaseTimer, 50);
+        break;
+
+    case eTestLate:
+        testGet(eTicketUrgent, eTestUp, 'u');
+        testGet(eTicketNormal, eTestUp, 'n');
+        break;
+
+    case eTestRelease:
+        testDone(testTvm.current);
+        break;
+
+    case eTestUp:
+        memcpy(&ticket, eventData, sizeof(ticket));
+        testCheck("posted isr ticket", ticket == testIsrTicket, FALSE);
+        testDone(ticket);
+        break;
+    }
+
+    // Holders without a post check their tickets
+    if (TICKET_IS_UP(testTvm, testIsrTicket) && (FALSE == testAgingStarted))
+    {
+        testDone(testIsrTicket);
+    }
+    if (TICKET_IS_UP(testTvm, testOverflow) && (FALSE == testAgingStarted))
+    {
+        testDone(testOverflow);
+        eventPost(TEST_PROCESS, eTestAging, NULL, 0);
+    }
+}
+
+static PROCESS_INIT_PROTO(testInit)
+{
+    process->handlerCurrent = testHandler;
+}
+
+static PROCESS_DEINIT_PROTO(testDeinit)
+{
+}
+
+PROCESS_CREATE(testProcess, testInit, testDeinit, TEST_PROCESS, NULL, NULL)
+
+/// @brief  Simulation ends when every ticket is up
+static void testEnd(void)
+{
+    if (strcmp(testLog, TEST_EXPECTED))
+    {
+        printf("up \"%s\", expected \"%s\"\n", testLog, TEST_EXPECTED);
+        testErrors++;
+    }
+    testCheck("nobody waits", testTvm.current, testTvm.next);
+    testCheck("overflows", testQueue.overflows, 1);
+    testCheck("urgent count", testQueue.stats[eTicketUrgent].count, 3);
+    testCheck("normal count", testQueue.stats[eTicketNormal].count, 4);
+    testCheck("bulk count", testQueue.stats[eTicketBulk].count, 2);
+    testCheck("bulk max", testQueue.stats[eTicketBulk].max, 50);
+    testCheck("bulk promoted", testQueue.stats[eTicketBulk].promoted, 1);
+
+    printf("ticket errors=%u\n", testErrors);
+    exit(testErrors ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+
+int main(void)
+{
+    platformInit();
+    coreInit();
+    TVM_QUEUE_SET(testTvm, testQueue);
+    processStart(&testProcess);
+
+    eventPost(TEST_PROCESS, eTestClasses, NULL, 0);
+
+    coreRun();
+}
@@ -0,0 +1,152 @@
+/** @file       test_timer_wheel.c
+ *  @brief      Checks that software timers on the timing wheels expire at their exact tick across wheel levels,
+ *              that stopped and restarted timers do not fire at their old expiry and that slack stays in its window
+ *  @copyright  (c) 2026-Arcelik - All Rights Reserved
+ *              Permission to use, reproduce, copy, prepare derivative works,
+ *              modify, distribute, perform, display or sell this software and/or
+ *              its documentation for any purpose is prohibited without the express
+ *              written consent of Arcelik A.S.
+ *  @date       17.10.2026
+ */
+#include "rcos.h"
+#include <stdio.h>
+
+/// @brief  Number of ticks run by the test, long enough to cascade from every wheel level used
+#define TEST_TICKS (400000ul)
+/// @brief  Slack of slack timer
+#define TEST_SLACK (50)
+
+static void testTickNone(void)
+{
+}
+
+CORE_EVENTQUEUE_SIZE(256)
+CORE_TICK_CREATE(testTickNone, testTickNone, testTickNone)
+CORE_WDT_CREATE(testTickNone, testTickNone, testTickNone, 0)
+
+/// @brief  Periods around the slot counts of first and upper wheel levels
+static const uint32_t testPeriods[] = {1, 2, 63, 64, 65, 127, 128, 1000, 1023, 1024, 1025, 4095, 4096, 4097,
+                                       65535, 65536, 65537, 300001};
+
+static tsTimerCallBack testTimers[ARRAY_SIZE(testPeriods)];
+static uint32_t testDue[ARRAY_SIZE(testPeriods)]; ///< Tick each periodic timer must fire at next
+static uint32_t testFired[ARRAY_SIZE(testPeriods)];
+static uint32_t testErrors;
+
+static uint32_t testStoppedFired;
+static uint32_t testRestartedFired;
+static uint32_t testRestartedTick;
+static uint32_t testSlackFired;
+static uint32_t testSlackDue;
+
+/// @brief  Periodic timer, checks its expiry tick and restarts with the same period
+static TIMER_CALLBACK_FUNC(testPeriodic)
+{
+    uint32_t idx = (uint32_t)(uintptr_t)parameter;
+
+    if (rcosTickCount() != testDue[idx])
+    {
+        if (testErrors++ < 10)
+        {
+            printf("period %u fired at %u, due %u\n", testPeriods[idx], rcosTickCount(), testDue[idx]);
+        }
+    }
+    testFired[idx]++;
+    testDue[idx] = rcosTickCount() + testPeriods[idx];
+
+    return testPeriods[idx];
+}
+
+static TIMER_CALLBACK_FUNC(testStopped)
+{
+    testStoppedFired++;
+    return 0;
+}
+
+static TIMER_CALLBACK_FUNC(testRestarted)
+{
+    testRestartedFired++;
+    testRestartedTick = rcosTickCount();
+    return 0;
+}
+
+static TIMER_CALLBACK_FUNC(testSlack)
+{
+    if ((rcosTickCount() < testSlackDue) || (rcosTickCount() > (testSlackDue + TEST_SLACK)))
+    {
+        if (testErrors++ < 10)
+        {
+            printf("slack timer fired at %u, due %u\n", rcosTickCount(), testSlackDue);
+        }
+    }
+    testSlackFired++;
+    testSlackDue = rcosTickCount() + 1000; // Restart counts from the delayed expiry
+
+    return 1000;
+}
+
+TIMER_CALLBACK_CREATE(testStoppedTimer, testStopped, NULL)
+TIMER_CALLBACK_CREATE(testRestartedTimer, testRestarted, NULL)
+TIMER_CALLBACK_CREATE(testSlackTimer, testSlack, NULL)
+
+int main(void)
+{
+    uint32_t idx;
+    uint32_t tick;
+
+    platformInit();
+    coreInit();
+
+    for (idx = 0; idx < ARRAY_SIZE(testPeriods); idx++)
+    {
+        testTimers[idx].callBack  = testPeriodic;
+        testTimers[idx].parameter = (void *)(uintptr_t)idx;
+        testDue[idx]              = rcosTickCount() + testPeriods[idx];
+        timerCallBackStart(&testTimers[idx], testPeriods[idx]);
+    }
+    timerCallBackStart(&testStoppedTimer, 500);
+    timerCallBackStart(&testRestartedTimer, 1000);
+    testSlackDue = rcosTickCount() + 1000;
+    timerCallBackStartSlack(&testSlackTimer, 1000, TEST_SLACK);
+
+    for (tick = 1; tick <= TEST_TICKS; tick++)
+    {
+        hostIsrRun(rcosTickIsr);
+        if (100 == tick)
+        {
+            timerCallBackStop(&testStoppedTimer);
+        }
+        else if (10 == tick)
+        {
+            timerCallBackStart(&testRestartedTimer, 20);
+        }
+    }
+
+    for (idx = 0; idx < ARRAY_SIZE(testPeriods); idx++)
+    {
+        if (testFired[idx] != (TEST_TICKS / testPeriods[idx]))
+        {
+            printf("period %u fired %u times, expected %lu\n", testPeriods[idx], testFired[idx], TEST_TICKS / testPeriods[idx]);
+            testErrors++;
+        }
+    }
+    if (testStoppedFired)
+    {
+        printf("stopped timer fired\n");
+        testErrors++;
+    }
+    if ((1 != testRestartedFired) || (30 != testRestartedTick))
+    {
+        printf("restarted timer fired %u times, last at %u\n", testRestartedFired, testRestartedTick);
+        testErrors++;
+    }
+    if ((testSlackFired > (TEST_TICKS / 1000)) || (testSlackFired < (TEST_TICKS / (1000 + TEST_SLACK))))
+    {
+        printf("slack timer fired %u times\n", testSlackFired);
+        testErrors++;
+    }
+
+    printf("timer wheel errors=%u\n", testErrors);
+
+    return testErrors ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,144 @@
+/** @file       test_topic.c
+ *  @brief      Checks that a topic record reaches every subscriber with the publisher as its source, that it counts
+ *              against quota of publisher and that records published outside handlers have no publisher
+ *  @copyright  (c) 2026-Arcelik - All Rights Reserved
+ *              Permission to use, reproduce, copy, prepare derivative works,
+ *              modify, distribute, perform, display or sell this software and/or
+ *              its documentation for any purpose is prohibited without the express
+ *              written consent of Arcelik A.S.
+ *  @date       17.10.2026
+ */
+#include "rcos.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/// @brief  Handled records expected as subscriber:data:source
+#define TEST_EXPECTED "2:11:1 3:11:1 4:11:1 2:21:255 3:21:255 "
+/// @brief  Event of topic
+#define TEST_EVENT_TOPIC (7)
+/// @brief  Event that makes publisher publish
+#define TEST_EVENT_START (1)
+
+/// @brief  Process enumerations
+typedef enum
+{
+    eTestPublisher = 1,
+    eTestSubA,
+    eTestSubB,
+    eTestSubC, ///< Unsubscribes after its first record
+} teTestProcess;
+
+static void testEnd(void);
+
+CORE_EVENTQUEUE_SIZE(256)
+CORE_TICK_CREATE_SIMULATION(100, testEnd)
+CORE_WDT_DEFAULT(0)
+
+EVENT_QUOTA_CREATE(testQuota, 2, 0, 0, eOverloadDropNew, NULL)
+TOPIC_CREATE(testTopic, TEST_EVENT_TOPIC, 3)
+
+static char testLog[64];
+static uint8_t testLogLength;
+static uint8_t testErrors;
+
+/// @brief  Compare a counter or a result with its expected value
+static void testCheck(const char *name, uint32_t value, uint32_t expected)
+{
+    if (value != expected)
+    {
+        printf("%s=%u, expected %u\n", name, value, expected);
+        testErrors++;
+    }
+}
+
+/// @brief  Deferred callback runs from coreRun after handlers, its record has no publisher
+static TIMER_CALLBACK_FUNC(testPublishLater)
+{
+    uint8_t data = 0x21;
+
+    testCheck("deferred published", EXIT_SUCCESS == topicPublish(&testTopic, &data, sizeof(data)), TRUE);
+
+    return 0;
+}
+
+TIMER_CALLBACK_CREATE_DEFERRED(testDeferred, testPublishLater, NULL)
+
+static PROCESS_HANDLER_PROTO(testPublisherHandler)
+{
+    uint8_t data = 0x11;
+
+    // Event being handled and the first record fill the quota of 2
+    testCheck("published", EXIT_SUCCESS == topicPublish(&testTopic, &data, sizeof(data)), TRUE);
+    data = 0x12;
+    testCheck("published over quota", EXIT_SUCCESS == topicPublish(&testTopic, &data, sizeof(data)), FALSE);
+
+    timerCallBackStart(&testDeferred, 5);
+}
+
+static PROCESS_HANDLER_PROTO(testSubscriberHandler)
+{
+    testCheck("topic event", eventCurrent.event, TEST_EVENT_TOPIC);
+    testCheck("topic length", eventCurrent.length, 1);
+    testLogLength += (uint8_t)snprintf(&testLog[testLogLength], sizeof(testLog) - testLogLength, "%u:%02x:%u ",
+                                       eventCurrent.destination, eventData[0], eventCurrent.source);
+
+    if (eTestSubC == process->enumeration)
+    {
+        testCheck("unsubscribed", EXIT_SUCCESS == topicUnsubscribe(&testTopic, process->enumeration), TRUE);
+    }
+}
+
+static PROCESS_INIT_PROTO(testInit)
+{
+    if (eTestPublisher == process->enumeration)
+    {
+        process->handlerCurrent = testPublisherHandler;
+        process->quota          = &testQuota;
+        return;
+    }
+
+    process->handlerCurrent = testSubscriberHandler;
+    testCheck("subscribed", EXIT_SUCCESS == topicSubscribe(&testTopic, process->enumeration), TRUE);
+    testCheck("subscribed twice", EXIT_SUCCESS == topicSubscribe(&testTopic, process->enumeration), FALSE);
+}
+
+static PROCESS_DEINIT_PROTO(testDeinit)
+{
+}
+
+PROCESS_CREATE(testPublisher, testInit, testDeinit, eTestPublisher, NULL, NULL)
+PROCESS_CREATE(testSubA, testInit, testDeinit, eTestSubA, NULL, NULL)
+PROCESS_CREATE(testSubB, testInit, testDeinit, eTestSubB, NULL, NULL)
+PROCESS_CREATE(testSubC, testInit, testDeinit, eTestSubC, NULL, NULL)
+
+/// @brief  Simulation ends when every record is handled
+static void testEnd(void)
+{
+    if (strcmp(testLog, TEST_EXPECTED))
+    {
+        printf("handled \"%s\", expected \"%s\"\n", testLog, TEST_EXPECTED);
+        testErrors++;
+    }
+    testCheck("published count", testTopic.published, 2);
+    testCheck("publisher dropNew", testQuota.drops.dropNew, 1);
+    testCheck("subscribers", testTopic.count, 2);
+
+    printf("topic errors=%u\n", testErrors);
+    exit(testErrors ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+
+int main(void)
+{
+    platformInit();
+    coreInit();
+    processStart(&testPublisher);
+    processStart(&testSubA);
+    processStart(&testSubB);
+    processStart(&testSubC);
+    testCheck("topic full", EXIT_SUCCESS == topicSubscribe(&testTopic, eTestPublisher), FALSE);
+
+    eventPost(eTestPublisher, TEST_EVENT_START, NULL, 0);
+
+    coreRun();
+}
@@ -0,0 +1,277 @@
+/** @file       trace2json.c
+ *  @brief      Converts a binary trace stream sent by traceDrain into Chrome trace event json
+ *  @copyright  (c) 2026-Arcelik - All Rights Reserved
+ *              Permission to use, reproduce, copy, prepare derivative works,
+ *              modify, distribute, perform, display or sell this software and/or
+ *              its documentation for any purpose is prohibited without the express
+ *              written consent of Arcelik A.S.
+ *  @date       17.10.2026
+ *  @details    Usage: trace2json [trace.bin] > trace.json, standard input is read when no file is given.
+ *              Output can be opened with chrome://tracing or ui.perfetto.dev. Each process is a thread named by its
+ *              enumeration, isr posts, timers and idle periods have their own threads. Posts are connected to the
+ *              handler call of the same destination and event with flow arrows.
+ */
+#include "rcos.h"
+#include <stdio.h>
+#include <string.h>
+
+/// @brief  Thread id of isr posts
+#define TID_ISR (256)
+/// @brief  Thread id of timer events and callbacks
+#define TID_TIMER (257)
+/// @brief  Thread id of idle periods
+#define TID_IDLE (258)
+/// @brief  Number of thread ids
+#define TID_COUNT (259)
+
+/// @brief  Largest number of posts waiting for their handler call
+#define FLOWS_MAX (4096)
+
+/// @brief  A post waiting for its handler call
+typedef struct
+{
+    tProcessEnum destination;
+    tEventEnum event;
+    uint32_t id;
+} tsFlow;
+
+static tsFlow flows[FLOWS_MAX];
+static uint32_t flowCount;
+static uint32_t flowId;
+static uint8_t tidUsed[TID_COUNT];
+static uint8_t firstItem = 1;
+
+/// @brief  Print separator and opening of a trace event
+static void eventOpen(const char *phase, uint32_t tid, double ts)
+{
+    printf("%s\n{\"ph\":\"%s\",\"pid\":0,\"tid\":%u,\"ts\":%.3f", firstItem ? "" : ",", phase, tid, ts);
+    firstItem    = 0;
+    tidUsed[tid] = 1;
+}
+
+/// @brief  Thread of a post source
+static uint32_t sourceTid(tProcessEnum source, uint8_t kind)
+{
+    return ((eTracePostIsr == kind) || (PROCESS_NONE == source)) ? TID_ISR : source;
+}
+
+/// @brief  Remember a post to connect it to its handler call
+static void flowStart(uint32_t tid, double ts, tProcessEnum destination, tEventEnum event)
+{
+    if (flowCount == FLOWS_MAX)
+    {
+        memmove(&flows[0], &flows[1], sizeof(flows[0]) * (FLOWS_MAX - 1)); // Forget the oldest one
+        flowCount--;
+    }
+    flows[flowCount].destination = destination;
+    flows[flowCount].event       = event;
+    flows[flowCount].id          = ++flowId;
+    flowCount++;
+
+    eventOpen("s", tid, ts);
+    printf(",\"name\":\"post\",\"cat\":\"event\",\"id\":%u}", flowId);
+}
+
+/// @brief  Connect oldest post of destination and event to a handler call, or forget it if it is not drawn
+static void flowFinish(uint32_t tid, double ts, tProcessEnum destination, tEventEnum event, uint8_t draw)
+{
+    uint32_t idx;
+
+    for (idx = 0; idx < flowCount; idx++)
+    {
+        if ((flows[idx].destination == destination) && (flows[idx].event == event))
+        {
+            if (draw)
+            {
+                eventOpen("f", tid, ts);
+                printf(",\"bp\":\"e\",\"name\":\"post\",\"cat\":\"event\",\"id\":%u}", flows[idx].id);
+            }
+            memmove(&flows[idx], &flows[idx + 1], sizeof(flows[0]) * (flowCount - idx - 1));
+            flowCount--;
+            return;
+        }
+    }
+}
+
+/// @brief  Print name of a handler call
+static void eventName(tProcessEnum source, tProcessEnum destination, tEventEnum event)
+{
+    if ((EVENT_PT == event) && (source == destination))
+    {
+        printf(",\"name\":\"thread\"");
+    }
+    else
+    {
+        printf(",\"name\":\"event %u\"", event);
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    FILE *input = stdin;
+    tsTraceRecord record;
+    uint8_t bytes[sizeof(tsTraceRecord)];
+    double frequency = 1e9; // Host default until an eTraceSync record arrives
+    uint64_t cycles  = 0;
+    uint32_t last    = 0;
+    uint8_t started  = 0;
+    uint32_t lost;
+    uint32_t tid;
+    double ts;
+
+    if (argc > 1)
+    {
+        input = fopen(argv[1], "rb");
+        if (NULL == input)
+        {
+            perror(argv[1]);
+            return 1;
+        }
+    }
+
+    printf("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[");
+
+    while (sizeof(bytes) == fread(bytes, 1, sizeof(bytes), input))
+    {
+        // Records are little endian on the wire
+        record.time        = bytes[0] | ((uint32_t)bytes[1] << 8) | ((uint32_t)bytes[2] << 16) | ((uint32_t)bytes[3] << 24);
+        record.kind        = bytes[4];
+        record.source      = bytes[5];
+        record.destination = bytes[6];
+        record.event       = bytes[7];
+
+        if (eTraceSync == record.kind)
+        {
+            if (('R' != record.source) || ('T' != record.destination) || (CORE_TRACE_VERSION != record.event))
+            {
+                fprintf(stderr, "trace2json: unsupported sync record, version %u\n", record.event);
+                return 1;
+            }
+            frequency = record.time;
+            continue;
+        }
+
+        // Unwrap the 32-bit counter, isr posts may be recorded slightly out of order
+        if (started)
+        {
+            cycles += (int64_t)(int32_t)(record.time - last);
+        }
+        started = 1;
+        last    = record.time;
+        ts      = (double)(int64_t)cycles * 1e6 / frequency;
+
+        switch (record.kind)
+        {
+        case eTraceLost:
+            lost = record.source | ((uint32_t)record.destination << 8) | ((uint32_t)record.event << 16);
+            eventOpen("i", TID_IDLE, ts);
+            printf(",\"s\":\"g\",\"name\":\"lost %u records\"}", lost);
+            break;
+
+        case eTracePost:
+        case eTracePostIsr:
+            tid = sourceTid(record.source, record.kind);
+            eventOpen("i", tid, ts);
+            printf(",\"s\":\"t\",\"name\":\"post %u:%u\"}", record.destination, record.event);
+            if (PROCESS_NONE != record.destination) // Topic records have no single handler call to connect
+            {
+                flowStart(tid, ts, record.destination, record.event);
+            }
+            break;
+
+        case eTraceCoalesce:
+            eventOpen("i", sourceTid(record.source, record.kind), ts);
+            printf(",\"s\":\"t\",\"name\":\"coalesce %u:%u\"}", record.destination, record.event);
+            break;
+
+        case eTraceDrop:
+            eventOpen("i", sourceTid(record.source, record.kind), ts);
+            printf(",\"s\":\"t\",\"name\":\"drop %u:%u\"}", record.destination, record.event);
+            break;
+
+        case eTraceDropOld:
+            // Waiting event was dropped, its post will never be connected
+            eventOpen("i", sourceTid(record.source, record.kind), ts);
+            printf(",\"s\":\"t\",\"name\":\"drop oldest %u:%u\"}", record.destination, record.event);
+            flowFinish(0, ts, record.destination, record.event, 0);
+            break;
+
+        case eTraceOverrun:
+            eventOpen("i", record.destination, ts);
+            printf(",\"s\":\"t\",\"name\":\"overrun %u:%u %s%u ticks\"}", record.destination, record.event,
+                   (0xFF == record.source) ? ">=" : "", record.source);
+            break;
+
+        case eTraceTimer:
+            eventOpen("i", TID_TIMER, ts);
+            printf(",\"s\":\"t\",\"name\":\"timer %u:%u\"}", record.destination, record.event);
+            flowStart(TID_TIMER, ts, record.destination, record.event);
+            break;
+
+        case eTraceCallBack:
+            eventOpen("i", TID_TIMER, ts);
+            printf(",\"s\":\"t\",\"name\":\"callback\"}");
+            break;
+
+        case eTraceBegin:
+            eventOpen("B", record.destination, ts);
+            eventName(record.source, record.destination, record.event);
+            printf(",\"args\":{\"source\":%u}}", record.source);
+            flowFinish(record.destination, ts, record.destination, record.event, 1);
+            break;
+
+        case eTraceEnd:
+            eventOpen("E", record.destination, ts);
+            eventName(record.source, record.destination, record.event);
+            printf("}");
+            break;
+
+        case eTraceIdle:
+            eventOpen("B", TID_IDLE, ts);
+            printf(",\"name\":\"idle\"}");
+            break;
+
+        case eTraceWake:
+            eventOpen("E", TID_IDLE, ts);
+            printf(",\"name\":\"idle\"}");
+            break;
+
+        default:
+            fprintf(stderr, "trace2json: unknown record kind %u\n", record.kind);
+            break;
+        }
+    }
+
+    for (tid = 0; tid < TID_COUNT; tid++)
+    {
+        if (!tidUsed[tid])
+        {
+            continue;
+        }
+        printf(",\n{\"ph\":\"M\",\"pid\":0,\"tid\":%u,\"name\":\"thread_name\",\"args\":{\"name\":", tid);
+        switch (tid)
+        {
+        case TID_ISR:
+            printf("\"isr\"}}");
+            break;
+        case TID_TIMER:
+            printf("\"timers\"}}");
+            break;
+        case TID_IDLE:
+            printf("\"idle\"}}");
+            break;
+        default:
+            printf("\"process %u\"}}", tid);
+            break;
+        }
+    }
+
+    printf("\n]}\n");
+
+    if (input != stdin)
+    {
+        fclose(input);
+    }
+
+    return 0;
+}